@@ -0,0 +1,41 @@
+#ifndef SDL3PP_BENCH_HPP
+#define SDL3PP_BENCH_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+
+namespace bench
+{
+
+/**
+ * @brief Run a function several times and return the mean duration of a run
+ *        in milliseconds
+ *
+ * One untimed run is done first to warm the caches up.
+ */
+template <typename F>
+double measure_ms(std::size_t runs, F&& f)
+{
+    f();
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < runs; ++i)
+        f();
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count() / static_cast<double>(runs);
+}
+
+inline void report(std::string_view name, double ms, std::string_view extra = {})
+{
+    std::cout << std::left << std::setw(40) << name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(4) << ms << " ms";
+    if (!extra.empty())
+        std::cout << "  " << extra;
+    std::cout << std::endl;
+}
+
+}
+
+#endif
@@ -0,0 +1,87 @@
+#include <SDL3pp/SDL.hpp>
+#include <SDL3/SDL_audio.h>
+#include <SDL3/SDL_hints.h>
+#include <SDL3/SDL_init.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Hand 512 stereo frames over from a producer to a consumer through a
+// mutex-guarded queue and through SDL3pp::SpscRing, then feed the dummy
+// audio driver in real time from a game-like loop and report the
+// AudioStream counters.
+
+namespace
+{
+
+constexpr int channels = 2;
+constexpr int frequency = 48000;
+constexpr std::size_t block_frames = 512;
+constexpr std::size_t runs = 100000;
+
+}
+
+int main()
+{
+    std::vector<float> block(block_frames * channels, 0.25f);
+    std::vector<float> output(block.size());
+
+    std::mutex mutex;
+    std::deque<float> queue;
+    const double locked = bench::measure_ms(runs, [&] {
+        {
+            std::lock_guard lock(mutex);
+            queue.insert(queue.end(), block.begin(), block.end());
+        }
+        std::lock_guard lock(mutex);
+        std::copy_n(queue.begin(), output.size(), output.begin());
+        queue.erase(queue.begin(), queue.begin() + static_cast<std::ptrdiff_t>(output.size()));
+    });
+    bench::report("mutex + deque handoff", locked, std::to_string(block_frames) + " frames");
+
+    sdl::SpscRing<float> ring(block.size() * 4);
+    const double wait_free = bench::measure_ms(runs, [&] {
+        ring.write(block);
+        ring.read(output);
+    });
+    bench::report("SpscRing handoff", wait_free, std::to_string(block_frames) + " frames");
+
+    SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+    if (!SDL_Init(SDL_INIT_AUDIO))
+    {
+        std::cerr << "SDL_Init failed: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    {
+        // Two seconds of a 60 Hz game loop topping the ring up to 40 ms
+        sdl::AudioStream stream(channels, frequency, frequency / 25);
+        stream.write(block);
+        stream.resume();
+        const auto end = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (std::chrono::steady_clock::now() < end)
+        {
+            while (stream.get_writable_frames() >= block_frames)
+                stream.write(block);
+            std::this_thread::sleep_for(std::chrono::milliseconds(16));
+        }
+        const sdl::AudioStreamStats stats = stream.get_stats();
+        std::cout << "dummy driver: " << stats.played_frames << " frames played, "
+                  << stats.underruns << " underruns, " << stats.overruns << " overruns, latency "
+                  << std::chrono::duration<double, std::milli>(stats.min_latency).count() << " / "
+                  << std::chrono::duration<double, std::milli>(stats.average_latency).count() << " / "
+                  << std::chrono::duration<double, std::milli>(stats.max_latency).count() << " ms (min / avg / max)"
+                  << std::endl;
+    }
+
+    SDL_Quit();
+    return 0;
+}
@@ -0,0 +1,30 @@
+# Time the compilation of the units of the build time benchmark, with the
+# headers, then with the module when SDL3PP_WITH_MODULE is on:
+#
+#     cmake -DBUILD_DIR=<build directory> -P benchmarks/build_time/measure.cmake
+#
+# The units are touched first, so that only they are compiled again. The
+# module units need a compiler which imports the module, GCC 14, Clang 16
+# or MSVC 17.4: GCC 12 builds the module but exports nothing from it.
+
+if(NOT BUILD_DIR)
+	message(FATAL_ERROR "Set BUILD_DIR to the build directory")
+endif()
+
+file(GLOB HEADER_UNITS ${BUILD_DIR}/benchmarks/build_time/header_*.cpp)
+file(GLOB MODULE_UNITS ${BUILD_DIR}/benchmarks/build_time/module_*.cpp)
+
+# Builds the dependencies, SDL3pp and the module, out of the measure
+execute_process(COMMAND ${CMAKE_COMMAND} --build ${BUILD_DIR} --target SDL3pp)
+
+foreach(VARIANT header module)
+	string(TOUPPER ${VARIANT} UPPER_VARIANT)
+	if(NOT ${UPPER_VARIANT}_UNITS)
+		continue()
+	endif()
+	execute_process(COMMAND ${CMAKE_COMMAND} --build ${BUILD_DIR} --target build_time_${VARIANT})
+	file(TOUCH ${${UPPER_VARIANT}_UNITS})
+	list(LENGTH ${UPPER_VARIANT}_UNITS UNIT_COUNT)
+	message(STATUS "${UNIT_COUNT} units with the ${VARIANT}:")
+	execute_process(COMMAND ${CMAKE_COMMAND} -E time ${CMAKE_COMMAND} --build ${BUILD_DIR} --target build_time_${VARIANT})
+endforeach()
@@ -0,0 +1,56 @@
+#include <SDL3pp/SDL.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Compare a per-object visibility test and transform with the fused
+// Camera2D::transform_visible pass, with about a quarter of the objects
+// visible.
+
+namespace
+{
+
+constexpr std::size_t object_count = 200000;
+constexpr std::size_t runs = 50;
+
+}
+
+int main()
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> position(-2000, 2000);
+    std::uniform_int_distribution<int> size(1, 64);
+    std::vector<sdl::Rect> world;
+    world.reserve(object_count);
+    for (std::size_t i = 0; i < object_count; ++i)
+        world.emplace_back(position(rng), position(rng), size(rng), size(rng));
+
+    const sdl::Camera2D camera(sdl::Rect(-1000, -1000, 2000, 2000), 0.64f);
+    std::vector<sdl::Rect> screen(world.size());
+    std::vector<std::uint32_t> indices(world.size());
+
+    std::size_t visible = 0;
+    const double naive = bench::measure_ms(runs, [&] {
+        visible = 0;
+        for (std::size_t i = 0; i < world.size(); ++i)
+        {
+            if (!camera.is_visible(world[i]))
+                continue;
+            screen[visible] = camera.world_to_screen(world[i]);
+            indices[visible] = static_cast<std::uint32_t>(i);
+            ++visible;
+        }
+    });
+    bench::report("is_visible + world_to_screen", naive, std::to_string(visible) + " visible");
+
+    const double fused = bench::measure_ms(runs, [&] {
+        visible = camera.transform_visible(world, screen, indices);
+    });
+    bench::report("Camera2D::transform_visible", fused, std::to_string(visible) + " visible");
+
+    return 0;
+}
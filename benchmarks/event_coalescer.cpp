@@ -0,0 +1,117 @@
+#include <SDL3pp/SDL.hpp>
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_events.h>
+#include <SDL3/SDL_init.h>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Handle 1000 frames of an 8 kHz mouse at 60 frames per second, 133
+// motion events and one key per frame, each motion hit-testing a grid of
+// 256 widgets, once handling every event and once with the motions merged
+// by SDL3pp::EventCoalescer.
+
+namespace
+{
+
+constexpr std::size_t frame_count = 1000;
+constexpr std::size_t motions_per_frame = 133;
+constexpr std::size_t runs = 5;
+
+std::vector<sdl::Rect> make_widgets()
+{
+    std::vector<sdl::Rect> widgets;
+    for (int row = 0; row < 16; ++row)
+    {
+        for (int column = 0; column < 16; ++column)
+            widgets.emplace_back(column * 120, row * 67, 110, 60);
+    }
+    return widgets;
+}
+
+void push_frame(std::size_t frame)
+{
+    SDL_Event event;
+    for (std::size_t i = 0; i < motions_per_frame; ++i)
+    {
+        std::memset(&event, 0, sizeof(event));
+        event.type = SDL_EVENT_MOUSE_MOTION;
+        event.motion.windowID = 1;
+        event.motion.x = static_cast<float>((frame * motions_per_frame + i) % 1920);
+        event.motion.y = static_cast<float>(frame % 1080);
+        event.motion.xrel = 1.f;
+        SDL_PushEvent(&event);
+    }
+    std::memset(&event, 0, sizeof(event));
+    event.type = SDL_EVENT_KEY_DOWN;
+    event.key.windowID = 1;
+    SDL_PushEvent(&event);
+}
+
+// The hovered widget and the accumulated motion, as a UI would
+std::size_t handle_events(std::vector<sdl::Rect> const& widgets, float& distance)
+{
+    std::size_t hovered = 0;
+    SDL_Event event;
+    while (SDL_PollEvent(&event))
+    {
+        if (event.type != SDL_EVENT_MOUSE_MOTION)
+            continue;
+        distance += event.motion.xrel;
+        const sdl::Point cursor(static_cast<int>(std::floor(event.motion.x)),
+                                static_cast<int>(std::floor(event.motion.y)));
+        for (sdl::Rect const& widget : widgets)
+            hovered += widget.countains(cursor);
+    }
+    return hovered;
+}
+
+}
+
+int main()
+{
+    if (!SDL_Init(SDL_INIT_EVENTS))
+    {
+        std::cerr << "SDL_Init failed: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    {
+        const std::vector<sdl::Rect> widgets = make_widgets();
+        std::size_t hovered = 0;
+
+        float every_distance = 0.f;
+        const double every_ms = bench::measure_ms(runs, [&] {
+            for (std::size_t frame = 0; frame < frame_count; ++frame)
+            {
+                push_frame(frame);
+                SDL_PumpEvents();
+                hovered += handle_events(widgets, every_distance);
+            }
+        });
+        bench::report("every motion event", every_ms);
+
+        sdl::EventCoalescer coalescer;
+        float coalesced_distance = 0.f;
+        const double coalesced_ms = bench::measure_ms(runs, [&] {
+            for (std::size_t frame = 0; frame < frame_count; ++frame)
+            {
+                push_frame(frame);
+                coalescer.pump();
+                hovered += handle_events(widgets, coalesced_distance);
+            }
+        });
+        bench::report("SDL3pp::EventCoalescer", coalesced_ms,
+                      "dropped " + std::to_string(coalescer.get_dropped_events()) + ", distance "
+                          + std::to_string(every_distance) + " vs " + std::to_string(coalesced_distance)
+                          + ", hovered " + std::to_string(hovered));
+    }
+
+    SDL_Quit();
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include <SDL3pp/SDL.hpp>
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_events.h>
+#include <SDL3/SDL_init.h>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Record a synthetic session of 200k events, mostly mouse motions with
+// some keys and text, with SDL3pp::EventRecorder, then replay it through
+// the event queue of SDL as fast as possible, from the SDL_Event array it
+// was made of and with SDL3pp::EventPlayer reading the memory-mapped log.
+
+namespace
+{
+
+constexpr std::size_t event_count = 200000;
+constexpr std::size_t batch = 4096;
+constexpr std::size_t runs = 5;
+
+std::vector<SDL_Event> make_session()
+{
+    std::vector<SDL_Event> events(event_count);
+    for (std::size_t i = 0; i < events.size(); ++i)
+    {
+        SDL_Event& event = events[i];
+        std::memset(&event, 0, sizeof(event));
+        event.common.timestamp = static_cast<Uint64>(i + 1) * 1000000;
+        if (i % 50 == 0)
+        {
+            event.type = SDL_EVENT_TEXT_INPUT;
+            event.text.windowID = 1;
+            event.text.text = "a";
+        }
+        else if (i % 10 == 0)
+        {
+            event.type = (i % 20 == 0) ? SDL_EVENT_KEY_DOWN : SDL_EVENT_KEY_UP;
+            event.key.windowID = 1;
+            event.key.scancode = SDL_SCANCODE_A;
+        }
+        else
+        {
+            event.type = SDL_EVENT_MOUSE_MOTION;
+            event.motion.windowID = 1;
+            event.motion.x = static_cast<float>(i % 1920);
+            event.motion.y = static_cast<float>(i % 1080);
+            event.motion.xrel = 1.f;
+        }
+    }
+    return events;
+}
+
+std::size_t drain()
+{
+    std::size_t polled = 0;
+    SDL_Event event;
+    while (SDL_PollEvent(&event))
+        ++polled;
+    return polled;
+}
+
+}
+
+int main()
+{
+    if (!SDL_Init(SDL_INIT_EVENTS))
+    {
+        std::cerr << "SDL_Init failed: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    {
+        const std::vector<SDL_Event> session = make_session();
+        const std::string file = "sdl3pp_bench.events";
+        std::size_t polled = 0;
+
+        std::size_t bytes = 0;
+        const double record_ms = bench::measure_ms(runs, [&] {
+            sdl::EventRecorder recorder(file);
+            for (SDL_Event const& event : session)
+                recorder.record(event);
+            recorder.flush();
+            bytes = recorder.get_stats().recorded_bytes;
+        });
+        bench::report("SDL3pp::EventRecorder", record_ms, std::to_string(bytes) + " bytes");
+
+        const double array_ms = bench::measure_ms(runs, [&] {
+            for (std::size_t start = 0; start < session.size(); start += batch)
+            {
+                for (std::size_t i = start; i < start + batch && i < session.size(); ++i)
+                {
+                    SDL_Event event = session[i];
+                    event.common.timestamp = 0;
+                    SDL_PushEvent(&event);
+                }
+                polled += drain();
+            }
+        });
+        bench::report("SDL_Event array", array_ms);
+
+        const double player_ms = bench::measure_ms(runs, [&] {
+            sdl::EventPlayer player(file, sdl::PlaybackMode::as_fast_as_possible);
+            while (!player.is_finished())
+            {
+                player.update(batch);
+                polled += drain();
+            }
+        });
+        bench::report("SDL3pp::EventPlayer", player_ms, "polled " + std::to_string(polled));
+        std::remove(file.c_str());
+    }
+
+    SDL_Quit();
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include <SDL3pp/SDL.hpp>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Build the per-frame temporaries of a busy frame, a list of the visible
+// regions and an overlay RenderCommandList of 2000 rects in 200 colors,
+// from the global heap and from SDL3pp::FrameArena, counting the
+// allocations reaching the heap.
+
+namespace
+{
+
+constexpr std::size_t frame_count = 1000;
+constexpr std::size_t rect_count = 2000;
+constexpr std::size_t color_count = 200;
+constexpr std::size_t runs = 5;
+
+// Forwards to the heap, counting the allocations
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    std::size_t allocations = 0;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override
+    {
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+std::size_t build_frame(std::pmr::memory_resource* resource, std::size_t frame)
+{
+    std::pmr::vector<sdl::Rect> visible(resource);
+    for (std::size_t i = 0; i < rect_count; ++i)
+    {
+        const int x = static_cast<int>((i * 37 + frame) % 1920);
+        const int y = static_cast<int>((i * 91) % 1080);
+        if ((x + y) % 3 != 0)
+            visible.push_back(sdl::Rect(x, y, 16, 16));
+    }
+
+    sdl::RenderCommandList overlay(resource);
+    const std::size_t per_color = visible.size() / color_count;
+    for (std::size_t c = 0; c < color_count; ++c)
+    {
+        const auto shade = static_cast<Uint8>(c);
+        overlay.add_rects(std::span<const sdl::Rect>(visible).subspan(c * per_color, per_color),
+                          sdl::Color {shade, shade, shade, 255}, SDL_BLENDMODE_BLEND, true);
+    }
+    return overlay.get_size();
+}
+
+}
+
+int main()
+{
+    std::size_t commands = 0;
+
+    CountingResource heap_counter;
+    const double heap = bench::measure_ms(runs, [&] {
+        for (std::size_t frame = 0; frame < frame_count; ++frame)
+            commands += build_frame(&heap_counter, frame);
+    });
+    bench::report("global heap", heap / frame_count,
+                  "per frame, " + std::to_string(heap_counter.allocations / ((runs + 1) * frame_count))
+                      + " heap allocations per frame");
+
+    CountingResource arena_counter;
+    sdl::FrameArena arena(1 << 12, &arena_counter);
+    const double arena_ms = bench::measure_ms(runs, [&] {
+        for (std::size_t frame = 0; frame < frame_count; ++frame)
+        {
+            arena.next_frame();
+            commands += build_frame(&arena, frame);
+        }
+    });
+    bench::report("FrameArena", arena_ms / frame_count,
+                  std::to_string(arena_counter.allocations) + " heap allocations in total, "
+                      + std::to_string(arena.get_stats().peak_bytes) + " bytes peak");
+
+    return commands == 0 ? 1 : 0;
+}
@@ -0,0 +1,85 @@
+#include <SDL3pp/SDL.hpp>
+#include <SDL3/SDL_render.h>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Draw a HUD of 10k glyphs per frame. Compare rendering every line with
+// TTF_RenderText_Blended into a fresh texture with SDL3pp::GlyphCache,
+// which rasterizes each glyph once and draws batched quads.
+//
+// usage: bench_glyph_cache path/to/font.ttf
+
+namespace
+{
+
+constexpr int width = 1280;
+constexpr int height = 720;
+constexpr std::size_t lines = 200;
+constexpr std::size_t columns = 50;
+constexpr std::size_t frames = 10;
+
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: " << argv[0] << " font.ttf" << std::endl;
+        return 1;
+    }
+    if (!TTF_Init())
+    {
+        std::cerr << "TTF_Init failed: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    {
+        sdl::Surface surface(width, height);
+        sdl::Renderer renderer(surface);
+        sdl::Font font(argv[1], 12.f);
+
+        std::vector<std::string> text(lines);
+        for (std::size_t line = 0; line < lines; ++line)
+        {
+            for (std::size_t column = 0; column < columns; ++column)
+                text[line] += static_cast<char>('!' + (line * 7 + column * 13) % 94);
+        }
+        const int line_skip = font.get_line_skip();
+
+        const double immediate = bench::measure_ms(frames, [&] {
+            for (std::size_t line = 0; line < lines; ++line)
+            {
+                sdl::Texture texture(renderer, font.render_text(text[line], sdl::Color{255, 255, 255, 255}));
+                const SDL_FRect dst{0.f, static_cast<float>(static_cast<int>(line) * line_skip % height),
+                                    static_cast<float>(texture.get_width()), static_cast<float>(texture.get_height())};
+                SDL_RenderTexture(renderer.get(), texture.get(), nullptr, &dst);
+            }
+            renderer.present();
+        });
+        bench::report("TTF_RenderText_Blended per line", immediate,
+                      std::to_string(lines * columns) + " glyphs/frame");
+
+        sdl::GlyphCache glyphs(renderer);
+        sdl::SpriteBatch batch(lines * columns);
+        const double cached = bench::measure_ms(frames, [&] {
+            glyphs.next_frame();
+            for (std::size_t line = 0; line < lines; ++line)
+                glyphs.draw_text(batch, font, text[line], sdl::Point(0, static_cast<int>(line) * line_skip % height));
+            batch.flush(renderer);
+            renderer.present();
+        });
+        sdl::GlyphCacheStats const& stats = glyphs.get_stats();
+        bench::report("GlyphCache + SpriteBatch", cached,
+                      std::to_string(stats.hits) + " hits, " + std::to_string(stats.misses) + " misses, "
+                      + std::to_string(glyphs.get_page_count()) + " pages, "
+                      + std::to_string(batch.get_draw_calls()) + " draw calls/frame");
+    }
+
+    TTF_Quit();
+    return 0;
+}
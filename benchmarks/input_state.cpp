@@ -0,0 +1,81 @@
+#include <SDL3pp/SDL.hpp>
+#include <SDL3/SDL_keyboard.h>
+#include <SDL3/SDL_scancode.h>
+#include <array>
+#include <cstddef>
+#include <string>
+
+#include "Bench.hpp"
+
+// Derive the pressed and released keys of 100k frames and poll 64 keys
+// per frame, by copying the keyboard state of SDL every frame and
+// comparing it with the copy of the previous frame, and with
+// SDL3pp::InputState.
+
+namespace
+{
+
+constexpr std::size_t frame_count = 100000;
+constexpr std::size_t polls_per_frame = 64;
+constexpr std::size_t runs = 5;
+
+// The usual per-project helper: two copies of the array, compared bool by bool
+class CopiedKeyboard
+{
+public:
+    void update()
+    {
+        int count = 0;
+        const bool* const keys = SDL_GetKeyboardState(&count);
+        m_previous = m_current;
+        for (std::size_t key = 0; key < static_cast<std::size_t>(count) && key < m_current.size(); ++key)
+            m_current[key] = keys[key];
+    }
+
+    bool is_pressed(std::size_t key) const
+    {
+        return m_current[key] && !m_previous[key];
+    }
+
+    bool is_released(std::size_t key) const
+    {
+        return !m_current[key] && m_previous[key];
+    }
+
+private:
+    std::array<bool, SDL_SCANCODE_COUNT> m_current {};
+    std::array<bool, SDL_SCANCODE_COUNT> m_previous {};
+};
+
+}
+
+int main()
+{
+    std::size_t edges = 0;
+
+    CopiedKeyboard copied;
+    const double copied_ms = bench::measure_ms(runs, [&] {
+        for (std::size_t frame = 0; frame < frame_count; ++frame)
+        {
+            copied.update();
+            for (std::size_t key = 0; key < polls_per_frame; ++key)
+                edges += copied.is_pressed(key * 4) || copied.is_released(key * 4);
+        }
+    });
+    bench::report("copied keyboard array", copied_ms);
+
+    SDL3pp::InputState input;
+    const double input_ms = bench::measure_ms(runs, [&] {
+        for (std::size_t frame = 0; frame < frame_count; ++frame)
+        {
+            input.update();
+            for (std::size_t key = 0; key < polls_per_frame; ++key)
+            {
+                const auto scancode = static_cast<SDL_Scancode>(key * 4);
+                edges += input.is_key_pressed(scancode) || input.is_key_released(scancode);
+            }
+        }
+    });
+    bench::report("SDL3pp::InputState", input_ms, "edges " + std::to_string(edges));
+    return 0;
+}
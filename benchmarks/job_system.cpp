@@ -0,0 +1,107 @@
+#include <SDL3pp/SDL.hpp>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Update 1M particles serially, with one std::thread per core and with
+// JobSystem::parallel_for, then measure the cost of submitting and
+// waiting for small independent jobs. Last, stress parallel_for with
+// many one-item chunks, which finish while the next ones are submitted,
+// and check that no chunk runs after it returns.
+
+namespace
+{
+
+constexpr std::size_t particle_count = 1000000;
+constexpr std::size_t small_jobs = 10000;
+constexpr std::size_t runs = 50;
+constexpr std::size_t stress_items = 4096;
+constexpr std::size_t stress_rounds = 200;
+constexpr std::size_t stress_runs = 5;
+
+struct Particle
+{
+    float x;
+    float y;
+    float vx;
+    float vy;
+};
+
+void update(std::vector<Particle>& particles, std::size_t begin, std::size_t end)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        Particle& p = particles[i];
+        p.vy += 0.1f;
+        p.x += p.vx;
+        p.y += p.vy;
+        p.vx *= std::exp(-0.01f * std::abs(p.vx));
+    }
+}
+
+}
+
+int main()
+{
+    std::vector<Particle> particles(particle_count, Particle {0.f, 0.f, 1.f, -2.f});
+    sdl::JobSystem& jobs = sdl::JobSystem::get_instance();
+    const std::string threads = std::to_string(jobs.get_worker_count() + 1) + " threads";
+
+    const double serial = bench::measure_ms(runs, [&] { update(particles, 0, particles.size()); });
+    bench::report("serial update", serial, "1 thread");
+
+    const double spawned = bench::measure_ms(runs, [&] {
+        const std::size_t count = jobs.get_worker_count() + 1;
+        std::vector<std::thread> workers;
+        for (std::size_t t = 0; t < count; ++t)
+            workers.emplace_back([&, t] {
+                update(particles, particles.size() * t / count, particles.size() * (t + 1) / count);
+            });
+        for (std::thread& worker : workers)
+            worker.join();
+    });
+    bench::report("std::thread per frame", spawned, threads);
+
+    const double pooled = bench::measure_ms(runs, [&] {
+        jobs.parallel_for(0, particles.size(), 0, [&](std::size_t begin, std::size_t end) {
+            update(particles, begin, end);
+        });
+    });
+    bench::report("JobSystem::parallel_for", pooled, threads);
+
+    std::atomic<std::size_t> done {0};
+    const double submitted = bench::measure_ms(runs, [&] {
+        sdl::JobSystem::Counter counter;
+        for (std::size_t i = 0; i < small_jobs; ++i)
+            jobs.submit([&] { done.fetch_add(1, std::memory_order_relaxed); }, &counter);
+        jobs.wait(counter);
+    });
+    bench::report("JobSystem::submit + wait", submitted, std::to_string(small_jobs) + " jobs");
+
+    std::size_t late_chunks = 0;
+    const double stressed = bench::measure_ms(stress_runs, [&] {
+        for (std::size_t round = 0; round < stress_rounds; ++round)
+        {
+            // On the stack of the caller, as the counter of parallel_for
+            std::atomic<std::size_t> covered {0};
+            jobs.parallel_for(0, stress_items, 1, [&covered](std::size_t begin, std::size_t end) {
+                covered.fetch_add(end - begin, std::memory_order_relaxed);
+            });
+            late_chunks += stress_items - covered.load(std::memory_order_relaxed);
+        }
+    });
+    bench::report("JobSystem::parallel_for, grain 1", stressed,
+                  std::to_string(stress_items * stress_rounds) + " chunks per run, " + std::to_string(late_chunks)
+                      + " late");
+
+    const sdl::JobSystemStats stats = jobs.get_stats();
+    std::cout << "pool: " << stats.executed_jobs << " jobs run, " << stats.stolen_jobs << " stolen, "
+              << stats.inline_jobs << " run inline" << std::endl;
+    return late_chunks == 0 ? 0 : 1;
+}
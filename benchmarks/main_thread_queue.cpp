@@ -0,0 +1,91 @@
+#include <SDL3pp/SDL.hpp>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Hand tasks with a 32-byte capture from 3 worker threads over to the
+// main thread, which drains them in a loop, through a mutex-guarded
+// std::deque of std::function and through SDL3pp::MainThreadQueue.
+
+namespace
+{
+
+constexpr std::size_t producer_count = 3;
+constexpr std::size_t tasks_per_producer = 20000;
+constexpr std::size_t runs = 20;
+
+struct Payload
+{
+    std::size_t values[4];
+};
+
+}
+
+int main()
+{
+    const std::size_t total = producer_count * tasks_per_producer;
+    std::atomic<std::size_t> sink {0};
+
+    std::mutex mutex;
+    std::deque<std::function<void()>> locked_queue;
+    const double locked = bench::measure_ms(runs, [&] {
+        std::vector<std::thread> producers;
+        for (std::size_t t = 0; t < producer_count; ++t)
+            producers.emplace_back([&] {
+                for (std::size_t i = 0; i < tasks_per_producer; ++i)
+                {
+                    const Payload payload {{i, i, i, i}};
+                    std::lock_guard lock(mutex);
+                    locked_queue.emplace_back([&sink, payload] {
+                        sink.fetch_add(payload.values[0], std::memory_order_relaxed);
+                    });
+                }
+            });
+        std::size_t done = 0;
+        std::deque<std::function<void()>> batch;
+        while (done < total)
+        {
+            {
+                std::lock_guard lock(mutex);
+                batch.swap(locked_queue);
+            }
+            for (auto& task : batch)
+                task();
+            done += batch.size();
+            batch.clear();
+        }
+        for (std::thread& producer : producers)
+            producer.join();
+    });
+    bench::report("mutex + deque<std::function>", locked, std::to_string(total) + " tasks");
+
+    // Sized for the burst, as a queue drained once per frame should be
+    sdl::MainThreadQueue queue(total);
+    const double lock_free = bench::measure_ms(runs, [&] {
+        std::vector<std::thread> producers;
+        for (std::size_t t = 0; t < producer_count; ++t)
+            producers.emplace_back([&] {
+                for (std::size_t i = 0; i < tasks_per_producer; ++i)
+                {
+                    const Payload payload {{i, i, i, i}};
+                    queue.post([&sink, payload] { sink.fetch_add(payload.values[0], std::memory_order_relaxed); });
+                }
+            });
+        std::size_t done = 0;
+        while (done < total)
+            done += queue.drain();
+        for (std::thread& producer : producers)
+            producer.join();
+    });
+    bench::report("MainThreadQueue", lock_free,
+                  std::to_string(total) + " tasks, " + std::to_string(queue.get_stats().full_waits) + " full waits");
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+#include <SDL3pp/SDL.hpp>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Cost of the SDL3pp::MemoryTracker hooks: 100000 SDL_malloc() and
+// SDL_free() pairs of mixed sizes through the original allocator of SDL
+// and through the tracked one, on one thread and on four threads.
+
+namespace
+{
+
+constexpr std::size_t pair_count = 100000;
+constexpr std::size_t thread_count = 4;
+constexpr std::size_t runs = 5;
+
+std::size_t get_size(std::size_t i) noexcept
+{
+    return 16 + (i * 37) % 1024;
+}
+
+template <typename Malloc, typename Free>
+std::size_t churn(Malloc&& allocate, Free&& release)
+{
+    // A few live blocks, as SDL keeps some while it frees others
+    void* live[8] {};
+    std::size_t touched = 0;
+    for (std::size_t i = 0; i < pair_count; ++i)
+    {
+        void*& slot = live[i % 8];
+        release(slot);
+        slot = allocate(get_size(i));
+        static_cast<unsigned char*>(slot)[0] = 1;
+        ++touched;
+    }
+    for (void* memory : live)
+        release(memory);
+    return touched;
+}
+
+template <typename F>
+void run_threads(F&& f)
+{
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < thread_count; ++t)
+        threads.emplace_back(f);
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+}
+
+int main()
+{
+    sdl::MemoryTracker::install();
+
+    SDL_malloc_func original_malloc = nullptr;
+    SDL_calloc_func original_calloc = nullptr;
+    SDL_realloc_func original_realloc = nullptr;
+    SDL_free_func original_free = nullptr;
+    SDL_GetOriginalMemoryFunctions(&original_malloc, &original_calloc, &original_realloc, &original_free);
+
+    std::size_t touched = 0;
+    const auto original = [&] {
+        return churn(original_malloc, original_free);
+    };
+    const auto tracked = [&] {
+        const sdl::MemoryScope scope(sdl::MemoryTag::general);
+        return churn(&SDL_malloc, &SDL_free);
+    };
+
+    const double original_ms = bench::measure_ms(runs, [&] { touched += original(); });
+    bench::report("original, 1 thread", original_ms);
+
+    sdl::MemoryTracker::next_frame();
+    const double tracked_ms = bench::measure_ms(runs, [&] { touched += tracked(); });
+    bench::report("tracked, 1 thread", tracked_ms,
+                  std::to_string(sdl::MemoryTracker::get_frame_allocations()) + " allocations counted");
+
+    const double original_threads = bench::measure_ms(runs, [&] { run_threads(original); });
+    bench::report("original, 4 threads", original_threads);
+
+    sdl::MemoryTracker::next_frame();
+    const double tracked_threads = bench::measure_ms(runs, [&] { run_threads(tracked); });
+    const sdl::MemoryStats stats = sdl::MemoryTracker::get_stats();
+    bench::report("tracked, 4 threads", tracked_threads,
+                  std::to_string(sdl::MemoryTracker::get_frame_allocations()) + " allocations counted, "
+                      + std::to_string(stats.total.peak_bytes) + " bytes peak");
+
+    return touched == 0 ? 1 : 0;
+}
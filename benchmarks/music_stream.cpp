@@ -0,0 +1,103 @@
+#include <SDL3pp/SDL.hpp>
+#include <SDL3/SDL_iostream.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Decode a three minute 16-bit stereo WAV track held in memory, first
+// entirely up front as a fully loaded track would be, then through
+// SDL3pp::MusicStream, and compare the time to the first sample and the
+// memory each needs.
+
+namespace
+{
+
+constexpr int channels = 2;
+constexpr int frequency = 44100;
+constexpr std::size_t frames = static_cast<std::size_t>(frequency) * 180;
+
+void put_u16(std::vector<std::uint8_t>& data, std::uint16_t value)
+{
+    data.push_back(static_cast<std::uint8_t>(value));
+    data.push_back(static_cast<std::uint8_t>(value >> 8));
+}
+
+void put_u32(std::vector<std::uint8_t>& data, std::uint32_t value)
+{
+    put_u16(data, static_cast<std::uint16_t>(value));
+    put_u16(data, static_cast<std::uint16_t>(value >> 16));
+}
+
+std::vector<std::uint8_t> make_track()
+{
+    const auto data_size = static_cast<std::uint32_t>(frames * channels * 2);
+    std::vector<std::uint8_t> data;
+    data.reserve(44 + data_size);
+    data.insert(data.end(), {'R', 'I', 'F', 'F'});
+    put_u32(data, 36 + data_size);
+    data.insert(data.end(), {'W', 'A', 'V', 'E', 'f', 'm', 't', ' '});
+    put_u32(data, 16);
+    put_u16(data, 1);
+    put_u16(data, channels);
+    put_u32(data, frequency);
+    put_u32(data, frequency * channels * 2);
+    put_u16(data, channels * 2);
+    put_u16(data, 16);
+    data.insert(data.end(), {'d', 'a', 't', 'a'});
+    put_u32(data, data_size);
+    for (std::size_t i = 0; i < frames * channels; ++i)
+        put_u16(data, static_cast<std::uint16_t>(i * 37));
+    return data;
+}
+
+std::string mebibytes(std::size_t bytes)
+{
+    return std::to_string(static_cast<double>(bytes) / (1024. * 1024.)) + " MiB";
+}
+
+}
+
+int main()
+{
+    const std::vector<std::uint8_t> track = make_track();
+    const auto open = [&] {
+        return std::make_unique<sdl::WavDecoder>(SDL_IOFromConstMem(track.data(), track.size()));
+    };
+
+    std::vector<float> loaded;
+    const double full = bench::measure_ms(3, [&] {
+        auto decoder = open();
+        loaded.assign(decoder->get_length() * channels, 0.f);
+        decoder->decode(loaded);
+    });
+    bench::report("full decode, first sample after", full, mebibytes(loaded.size() * sizeof(float)) + " resident");
+
+    std::vector<float> block(1024 * channels);
+    std::size_t read = 0;
+    sdl::MusicStreamStats stats;
+    const double streamed = bench::measure_ms(3, [&] {
+        sdl::MusicStream music(open());
+        read = 0;
+        while (!music.is_finished())
+        {
+            const std::size_t count = music.read(block);
+            read += count;
+            if (count == 0)
+                std::this_thread::yield();
+        }
+        stats = music.get_stats();
+    });
+    bench::report("MusicStream, first sample after",
+                  std::chrono::duration<double, std::milli>(stats.time_to_first_sample).count(),
+                  mebibytes(stats.resident_bytes) + " resident");
+    bench::report("MusicStream, whole track drained", streamed, std::to_string(read) + " frames");
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+#include <SDL3pp/SDL.hpp>
+#include <SDL3/SDL_render.h>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Compare the submission of many small rects one SDL call at a time with
+// the batched submission of SDL3pp::Renderer, on the software renderer so
+// that the benchmark runs headless.
+
+namespace
+{
+
+constexpr int width = 1280;
+constexpr int height = 720;
+constexpr std::size_t rect_count = 20000;
+constexpr std::size_t rects_per_color = 1000;
+constexpr std::size_t frames = 20;
+
+std::vector<sdl::Rect> make_rects()
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> x(0, width - 8);
+    std::uniform_int_distribution<int> y(0, height - 8);
+    std::uniform_int_distribution<int> size(1, 8);
+    std::vector<sdl::Rect> rects;
+    rects.reserve(rect_count);
+    for (std::size_t i = 0; i < rect_count; ++i)
+        rects.emplace_back(x(rng), y(rng), size(rng), size(rng));
+    return rects;
+}
+
+sdl::Color color_of(std::size_t index)
+{
+    const auto group = static_cast<Uint8>(index / rects_per_color);
+    return sdl::Color{static_cast<Uint8>(group * 37), static_cast<Uint8>(group * 91), 200, 255};
+}
+
+}
+
+int main()
+{
+    sdl::Surface surface(width, height);
+    sdl::Renderer renderer(surface);
+    const std::vector<sdl::Rect> rects = make_rects();
+
+    const double raw = bench::measure_ms(frames, [&] {
+        SDL_Renderer* r = renderer.get();
+        for (std::size_t i = 0; i < rects.size(); ++i)
+        {
+            const sdl::Color color = color_of(i);
+            SDL_SetRenderDrawColor(r, color.r, color.g, color.b, color.a);
+            const SDL_FRect rect{static_cast<float>(rects[i].get_x()), static_cast<float>(rects[i].get_y()),
+                                 static_cast<float>(rects[i].get_width()), static_cast<float>(rects[i].get_height())};
+            SDL_RenderFillRect(r, &rect);
+        }
+        SDL_RenderPresent(r);
+    });
+    bench::report("SDL_RenderFillRect per rect", raw);
+
+    for (bool batching : {false, true})
+    {
+        renderer.set_batching(batching);
+        renderer.reset_stats();
+        const double ms = bench::measure_ms(frames, [&] {
+            for (std::size_t i = 0; i < rects.size(); ++i)
+            {
+                renderer.set_draw_color(color_of(i));
+                renderer.fill_rect(rects[i]);
+            }
+            renderer.present();
+        });
+        const std::size_t calls = renderer.get_stats().draw_calls / (frames + 1);
+        bench::report(batching ? "Renderer batched" : "Renderer immediate", ms,
+                      std::to_string(calls) + " draw calls/frame");
+    }
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include <SDL3pp/SDL.hpp>
+#include <SDL3/SDL_render.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Compare one SDL_RenderTexture call per sprite with SDL3pp::SpriteBatch,
+// which sorts the sprites by texture and submits one SDL_RenderGeometry
+// call per run.
+
+namespace
+{
+
+constexpr int width = 1280;
+constexpr int height = 720;
+constexpr std::size_t texture_count = 8;
+constexpr std::size_t sprite_count = 20000;
+constexpr std::size_t frames = 10;
+
+struct SpriteDesc
+{
+    std::size_t texture;
+    sdl::Rect src;
+    sdl::Rect dst;
+};
+
+}
+
+int main()
+{
+    sdl::Surface surface(width, height);
+    sdl::Renderer renderer(surface);
+
+    std::vector<sdl::Texture> textures;
+    for (std::size_t i = 0; i < texture_count; ++i)
+    {
+        sdl::Surface image(64, 64);
+        image.fill(sdl::Color{static_cast<Uint8>(i * 30), 128, 255, 255});
+        textures.emplace_back(renderer, image);
+    }
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<std::size_t> texture(0, texture_count - 1);
+    std::uniform_int_distribution<int> x(0, width - 32);
+    std::uniform_int_distribution<int> y(0, height - 32);
+    std::uniform_int_distribution<int> cell(0, 3);
+    std::vector<SpriteDesc> sprites;
+    sprites.reserve(sprite_count);
+    for (std::size_t i = 0; i < sprite_count; ++i)
+        sprites.push_back(SpriteDesc{texture(rng), sdl::Rect(cell(rng) * 16, cell(rng) * 16, 16, 16),
+                                     sdl::Rect(x(rng), y(rng), 32, 32)});
+
+    const double immediate = bench::measure_ms(frames, [&] {
+        for (SpriteDesc const& sprite : sprites)
+        {
+            const SDL_FRect src{static_cast<float>(sprite.src.get_x()), static_cast<float>(sprite.src.get_y()), 16.f, 16.f};
+            const SDL_FRect dst{static_cast<float>(sprite.dst.get_x()), static_cast<float>(sprite.dst.get_y()), 32.f, 32.f};
+            SDL_RenderTexture(renderer.get(), textures[sprite.texture].get(), &src, &dst);
+        }
+        renderer.present();
+    });
+    bench::report("SDL_RenderTexture per sprite", immediate,
+                  std::to_string(sprite_count) + " draw calls/frame");
+
+    sdl::SpriteBatch batch(sprite_count);
+    const double batched = bench::measure_ms(frames, [&] {
+        for (SpriteDesc const& sprite : sprites)
+            batch.draw(textures[sprite.texture], sprite.src, sprite.dst);
+        batch.flush(renderer);
+        renderer.present();
+    });
+    bench::report("SpriteBatch", batched,
+                  std::to_string(batch.get_draw_calls()) + " draw calls/frame");
+
+    return 0;
+}
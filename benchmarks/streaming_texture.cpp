@@ -0,0 +1,71 @@
+#include <SDL3pp/SDL.hpp>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Bench.hpp"
+
+// A producer thread animates a small area of a 1080p image while the
+// render thread uploads it. Compare a full SDL_UpdateTexture per frame with
+// StreamingTexture, which only uploads the areas changed since each of its
+// textures was last written.
+
+namespace
+{
+
+constexpr int width = 1920;
+constexpr int height = 1080;
+constexpr std::size_t frames = 120;
+
+}
+
+int main()
+{
+    sdl::Surface surface(width, height);
+    sdl::Renderer renderer(surface);
+
+    sdl::Texture texture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STREAMING, width, height);
+    std::vector<unsigned char> image(static_cast<std::size_t>(width) * height * 4);
+    const double full = bench::measure_ms(frames, [&] {
+        texture.update(std::nullopt, image.data(), width * 4);
+    });
+    bench::report("SDL_UpdateTexture full frame", full,
+                  std::to_string(image.size()) + " bytes/frame");
+
+    sdl::StreamingTexture stream(renderer, width, height);
+    std::atomic<bool> running = true;
+    std::thread producer([&] {
+        for (int frame = 0; running; ++frame)
+        {
+            sdl::StreamingTexture::Frame staging = stream.acquire();
+            const sdl::Rect area((frame * 7) % (width - 256), 400, 256, 256);
+            auto* pixels = static_cast<unsigned char*>(staging.get_pixels());
+            for (int y = area.get_y(); y <= area.get_y2(); ++y)
+                std::memset(pixels + y * staging.get_pitch() + area.get_x() * 4, frame & 0xFF,
+                            static_cast<std::size_t>(area.get_width()) * 4);
+            staging.mark_dirty(area);
+            staging.submit();
+        }
+    });
+
+    std::size_t uploaded = 0;
+    stream.reset_stats();
+    const double streamed = bench::measure_ms(frames, [&] {
+        while (!stream.update())
+            std::this_thread::yield();
+        ++uploaded;
+    });
+    running = false;
+    producer.join();
+
+    const sdl::StreamingTextureStats stats = stream.get_stats();
+    bench::report("StreamingTexture update", streamed,
+                  std::to_string(stats.upload_bytes / uploaded) + " bytes/frame, "
+                  + std::to_string(stats.stall_time.count() / static_cast<long long>(uploaded)) + " ns stall/frame, "
+                  + std::to_string(stats.frames_dropped) + " dropped");
+
+    return 0;
+}
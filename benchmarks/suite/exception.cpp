@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+#include <string>
+#include <SDL3/SDL_error.h>
+#include <SDL3pp/SDL.hpp>
+
+// Construction of SDL3pp::Exception, which copies the SDL error message,
+// alone and thrown then caught.
+
+namespace
+{
+
+void exception_construct(benchmark::State& state)
+{
+    SDL_SetError("Invalid renderer");
+    for (auto _ : state)
+    {
+        sdl::Exception exception("SDL_RenderPresent");
+        benchmark::DoNotOptimize(exception.what());
+    }
+}
+BENCHMARK(exception_construct);
+
+void exception_construct_from_string(benchmark::State& state)
+{
+    SDL_SetError("Invalid renderer");
+    const std::string function = "SDL_RenderPresent";
+    for (auto _ : state)
+    {
+        sdl::Exception exception(function);
+        benchmark::DoNotOptimize(exception.what());
+    }
+}
+BENCHMARK(exception_construct_from_string);
+
+void exception_throw_catch(benchmark::State& state)
+{
+    SDL_SetError("Invalid renderer");
+    for (auto _ : state)
+    {
+        try
+        {
+            throw sdl::Exception("SDL_RenderPresent");
+        }
+        catch (sdl::Exception const& exception)
+        {
+            benchmark::DoNotOptimize(exception.what());
+        }
+    }
+}
+BENCHMARK(exception_throw_catch);
+
+}
@@ -0,0 +1,166 @@
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <SDL3pp/SDL.hpp>
+
+// Point and Rect operations over arrays of pseudo-random values, about half
+// of the rect pairs overlapping.
+
+namespace
+{
+
+constexpr std::size_t value_count = 4096;
+
+std::vector<sdl::Rect> make_rects()
+{
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> position(-500, 500);
+    std::uniform_int_distribution<int> size(1, 400);
+    std::vector<sdl::Rect> rects;
+    rects.reserve(value_count);
+    for (std::size_t i = 0; i < value_count; ++i)
+        rects.emplace_back(position(rng), position(rng), size(rng), size(rng));
+    return rects;
+}
+
+std::vector<sdl::Point> make_points()
+{
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> coordinate(-2000, 2000);
+    std::vector<sdl::Point> points;
+    points.reserve(value_count);
+    for (std::size_t i = 0; i < value_count; ++i)
+        points.emplace_back(coordinate(rng), coordinate(rng));
+    return points;
+}
+
+void rect_get_intersection(benchmark::State& state)
+{
+    const std::vector<sdl::Rect> rects = make_rects();
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(rects[i].get_intersection(rects[i + 1]));
+        i = (i + 2) % value_count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(rect_get_intersection);
+
+void rect_get_union(benchmark::State& state)
+{
+    const std::vector<sdl::Rect> rects = make_rects();
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(rects[i].get_union(rects[i + 1]));
+        i = (i + 2) % value_count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(rect_get_union);
+
+void rect_intersects(benchmark::State& state)
+{
+    const std::vector<sdl::Rect> rects = make_rects();
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(rects[i].intersects(rects[i + 1]));
+        i = (i + 2) % value_count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(rect_intersects);
+
+void rect_countains(benchmark::State& state)
+{
+    const std::vector<sdl::Rect> rects = make_rects();
+    const std::vector<sdl::Point> points = make_points();
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(rects[i].countains(points[i]));
+        i = (i + 1) % value_count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(rect_countains);
+
+void rect_intersect_line(benchmark::State& state)
+{
+    const std::vector<sdl::Rect> rects = make_rects();
+    const std::vector<sdl::Point> points = make_points();
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        sdl::Point a = points[i];
+        sdl::Point b = points[i + 1];
+        benchmark::DoNotOptimize(rects[i].intersect_line(a, b));
+        i = (i + 2) % value_count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(rect_intersect_line);
+
+void point_get_wrapped(benchmark::State& state)
+{
+    const std::vector<sdl::Point> points = make_points();
+    const sdl::Rect area(-100, -100, 640, 480);
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(points[i].get_wrapped(area));
+        i = (i + 1) % value_count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(point_get_wrapped);
+
+void point_get_clamped(benchmark::State& state)
+{
+    const std::vector<sdl::Point> points = make_points();
+    const sdl::Rect area(-100, -100, 640, 480);
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(points[i].get_clamped(area));
+        i = (i + 1) % value_count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(point_get_clamped);
+
+// A tight loop over the points, which the compiler can only vectorize
+// with the definition of clamp() at hand
+void point_clamp_array(benchmark::State& state)
+{
+    std::vector<sdl::Point> points = make_points();
+    const sdl::Rect area(-100, -100, 640, 480);
+    for (auto _ : state)
+    {
+        for (sdl::Point& point : points)
+            point.clamp(area);
+        benchmark::ClobberMemory();
+        points[0] += sdl::Point(1000, 1000);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(value_count));
+}
+BENCHMARK(point_clamp_array);
+
+void point_arithmetic(benchmark::State& state)
+{
+    const std::vector<sdl::Point> points = make_points();
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize((points[i] + points[i + 1]) * 3 / 2 % sdl::Point(640, 480));
+        i = (i + 2) % value_count;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(point_arithmetic);
+
+}
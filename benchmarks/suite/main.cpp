@@ -0,0 +1,31 @@
+#include <benchmark/benchmark.h>
+#include <iostream>
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_hints.h>
+#include <SDL3/SDL_init.h>
+#include <SDL3pp/SDL.hpp>
+
+// Entry point of sdl3pp_bench: SDL runs with the offscreen video driver,
+// so the window benchmarks need neither a display nor a GPU. Pass
+// --benchmark_out=<file> --benchmark_out_format=json, or build the
+// sdl3pp_bench_json target, to get results which can be compared between
+// versions with the compare.py tool of Google Benchmark.
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+    if (!SDL_Init(SDL_INIT_VIDEO))
+    {
+        std::cerr << "SDL_Init failed: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    SDL_Quit();
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include <benchmark/benchmark.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <SDL3pp/SDL.hpp>
+
+// Surface operations on 256x256 RGBA surfaces: fills, blits, conversion
+// and the plain getters.
+
+namespace
+{
+
+constexpr int surface_size = 256;
+
+void surface_fill(benchmark::State& state)
+{
+    sdl::Surface surface(surface_size, surface_size);
+    for (auto _ : state)
+        surface.fill(sdl::Color {32, 64, 128, 255});
+    state.SetBytesProcessed(state.iterations() * surface.get_pitch() * surface.get_height());
+}
+BENCHMARK(surface_fill);
+
+void surface_fill_rects(benchmark::State& state)
+{
+    sdl::Surface surface(surface_size, surface_size);
+    std::array<sdl::Rect, 64> rects;
+    for (std::size_t i = 0; i < rects.size(); ++i)
+    {
+        const int index = static_cast<int>(i);
+        rects[i] = sdl::Rect((index % 8) * 32, (index / 8) * 32, 16, 16);
+    }
+    for (auto _ : state)
+        surface.fill_rects(rects, sdl::Color {200, 100, 50, 255});
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(rects.size()));
+}
+BENCHMARK(surface_fill_rects);
+
+void surface_blit(benchmark::State& state)
+{
+    const auto size = static_cast<int>(state.range(0));
+    sdl::Surface source(size, size);
+    sdl::Surface destination(surface_size, surface_size);
+    source.fill(sdl::Color {255, 0, 0, 255});
+    for (auto _ : state)
+        source.blit(std::nullopt, destination, sdl::Point(7, 9));
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(surface_blit)->Arg(16)->Arg(64)->Arg(256);
+
+void surface_convert(benchmark::State& state)
+{
+    sdl::Surface surface(surface_size, surface_size);
+    for (auto _ : state)
+    {
+        sdl::Surface converted = surface.convert(SDL_PIXELFORMAT_XRGB8888);
+        benchmark::DoNotOptimize(converted.get());
+    }
+}
+BENCHMARK(surface_convert);
+
+void surface_get_size(benchmark::State& state)
+{
+    const sdl::Surface surface(surface_size, surface_size);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(surface.get_size());
+}
+BENCHMARK(surface_get_size);
+
+void surface_create_destroy(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        sdl::Surface surface(surface_size, surface_size);
+        benchmark::DoNotOptimize(surface.get());
+    }
+}
+BENCHMARK(surface_create_destroy);
+
+}
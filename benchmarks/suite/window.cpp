@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+#include <optional>
+#include <SDL3pp/SDL.hpp>
+
+// Window queries on a window of the offscreen video driver, which main()
+// selects; they are mostly the cost of the SDL calls behind the getters.
+
+namespace
+{
+
+// Window of the benchmark, created before and destroyed after its runs,
+// while SDL is initialized. The benchmarks keep the names they had without
+// the fixture, to compare with the results of older versions.
+class WindowFixture : public benchmark::Fixture
+{
+public:
+    void SetUp(benchmark::State& state) override
+    {
+        try
+        {
+            m_window.emplace("sdl3pp_bench", 640, 480, SDL_WINDOW_HIDDEN);
+        }
+        catch (sdl::Exception const& exception)
+        {
+            state.SkipWithError(exception.what());
+        }
+    }
+
+    void TearDown(benchmark::State&) override
+    {
+        m_window.reset();
+    }
+
+protected:
+    std::optional<sdl::Window> m_window;
+};
+
+BENCHMARK_DEFINE_F(WindowFixture, window_get_size)(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(m_window->get_size());
+}
+BENCHMARK_REGISTER_F(WindowFixture, window_get_size)->Name("window_get_size");
+
+BENCHMARK_DEFINE_F(WindowFixture, window_get_width)(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(m_window->get_width());
+}
+BENCHMARK_REGISTER_F(WindowFixture, window_get_width)->Name("window_get_width");
+
+BENCHMARK_DEFINE_F(WindowFixture, window_get_size_in_pixel)(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(m_window->get_size_in_pixel());
+}
+BENCHMARK_REGISTER_F(WindowFixture, window_get_size_in_pixel)->Name("window_get_size_in_pixel");
+
+BENCHMARK_DEFINE_F(WindowFixture, window_get_title)(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(m_window->get_title());
+}
+BENCHMARK_REGISTER_F(WindowFixture, window_get_title)->Name("window_get_title");
+
+BENCHMARK_DEFINE_F(WindowFixture, window_get_position)(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(m_window->get_position());
+}
+BENCHMARK_REGISTER_F(WindowFixture, window_get_position)->Name("window_get_position");
+
+void window_create_destroy(benchmark::State& state)
+{
+    try
+    {
+        for (auto _ : state)
+        {
+            sdl::Window window("sdl3pp_bench", 64, 64, SDL_WINDOW_HIDDEN);
+            benchmark::DoNotOptimize(window.get());
+        }
+    }
+    catch (sdl::Exception const& exception)
+    {
+        state.SkipWithError(exception.what());
+    }
+}
+BENCHMARK(window_create_destroy);
+
+}
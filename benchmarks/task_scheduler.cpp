@@ -0,0 +1,135 @@
+#include <SDL3pp/SDL.hpp>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Run 10k scripts which wait 3 frames, then 50 ms, then start over, as
+// hand-written state machines polled each frame and as Task coroutines
+// resumed by TaskScheduler, then spawn short-lived tasks to measure the
+// recycling of their frames by CoroutineFramePool.
+
+namespace
+{
+
+constexpr std::size_t script_count = 10000;
+constexpr std::size_t frame_count = 200;
+constexpr Uint64 frame_ms = 16;
+constexpr int wait_frames = 3;
+constexpr Uint64 wait_ms = 50;
+constexpr std::size_t short_tasks = 10000;
+constexpr std::size_t runs = 10;
+
+struct Script
+{
+    enum class State
+    {
+        waiting_frames,
+        waiting_time
+    };
+
+    State state = State::waiting_frames;
+    int frames = 0;
+    Uint64 deadline = 0;
+    std::size_t loops = 0;
+};
+
+void poll(Script& script, Uint64 ticks)
+{
+    switch (script.state)
+    {
+    case Script::State::waiting_frames:
+        if (++script.frames == wait_frames)
+        {
+            script.state = Script::State::waiting_time;
+            script.deadline = ticks + wait_ms;
+        }
+        break;
+    case Script::State::waiting_time:
+        if (ticks >= script.deadline)
+        {
+            script.state = Script::State::waiting_frames;
+            script.frames = 0;
+            ++script.loops;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+sdl::Task<> script(std::size_t& loops)
+{
+    for (;;)
+    {
+        for (int frame = 0; frame < wait_frames; ++frame)
+            co_await sdl::next_frame();
+        co_await sdl::delay(std::chrono::milliseconds(wait_ms));
+        ++loops;
+    }
+}
+
+sdl::Task<int> step(int value)
+{
+    co_await sdl::next_frame();
+    co_return value + 1;
+}
+
+sdl::Task<> short_task(std::size_t& sum)
+{
+    sum += static_cast<std::size_t>(co_await step(1));
+}
+
+}
+
+int main()
+{
+    std::size_t loops = 0;
+    const double polled = bench::measure_ms(runs, [&] {
+        std::vector<Script> scripts(script_count);
+        Uint64 ticks = 0;
+        for (std::size_t frame = 0; frame < frame_count; ++frame)
+        {
+            ticks += frame_ms;
+            for (Script& s : scripts)
+                poll(s, ticks);
+        }
+        for (Script const& s : scripts)
+            loops += s.loops;
+    });
+    bench::report("state machines, polled", polled / frame_count,
+                  "per frame, " + std::to_string(loops / (runs + 1)) + " loops");
+
+    loops = 0;
+    const double resumed = bench::measure_ms(runs, [&] {
+        sdl::TaskScheduler scheduler;
+        for (std::size_t i = 0; i < script_count; ++i)
+            scheduler.spawn(script(loops));
+        Uint64 ticks = 0;
+        for (std::size_t frame = 0; frame < frame_count; ++frame)
+        {
+            ticks += frame_ms;
+            scheduler.update(ticks);
+        }
+    });
+    bench::report("Task coroutines, TaskScheduler", resumed / frame_count,
+                  "per frame, " + std::to_string(loops / (runs + 1)) + " loops");
+
+    std::size_t sum = 0;
+    sdl::TaskScheduler scheduler;
+    sdl::CoroutineFramePool::reset_stats();
+    const double spawned = bench::measure_ms(runs, [&] {
+        for (std::size_t i = 0; i < short_tasks; ++i)
+            scheduler.spawn(short_task(sum));
+        while (scheduler.get_task_count() > 0)
+            scheduler.update(scheduler.get_ticks() + frame_ms);
+    });
+    const sdl::CoroutineFramePoolStats stats = sdl::CoroutineFramePool::get_stats();
+    bench::report("spawn + run 10k nested tasks", spawned,
+                  std::to_string(stats.allocations) + " frames, " + std::to_string(stats.heap_allocations)
+                      + " from the heap");
+
+    return 0;
+}
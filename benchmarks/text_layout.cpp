@@ -0,0 +1,77 @@
+#include <SDL3pp/SDL.hpp>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Lay out a 1 MB document wrapped at 600 pixels. Compare laying out the
+// whole document again after each keystroke, as a widget re-wrapping all
+// its text does, with SDL3pp::TextLayout, which only lays out the edited
+// paragraph and the lines in view.
+//
+// usage: bench_text_layout path/to/font.ttf
+
+namespace
+{
+
+constexpr int wrap_width = 600;
+constexpr int view_height = 720;
+constexpr std::size_t document_size = 1 << 20;
+constexpr std::size_t runs = 10;
+
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "usage: " << argv[0] << " font.ttf" << std::endl;
+        return 1;
+    }
+    if (!TTF_Init())
+    {
+        std::cerr << "TTF_Init failed: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    {
+        sdl::Font font(argv[1], 14.f);
+
+        std::string document;
+        for (std::size_t paragraph = 0; document.size() < document_size; ++paragraph)
+        {
+            for (std::size_t word = 0; word < 5 + paragraph % 40; ++word)
+                document += "lorem ipsum " + std::to_string(paragraph * 31 + word) + ' ';
+            document += '\n';
+        }
+
+        sdl::TextLayout layout(font, wrap_width);
+        const double load = bench::measure_ms(runs, [&] { layout.set_text(document); });
+        bench::report("set_text 1 MB", load,
+                      std::to_string(layout.get_paragraph_count()) + " paragraphs");
+
+        std::vector<sdl::TextLine> lines;
+        const double full = bench::measure_ms(runs, [&] {
+            layout.invalidate();
+            layout.get_lines(sdl::Rect(0, 0, wrap_width, layout.get_height()), lines);
+        });
+        bench::report("full relayout per keystroke", full,
+                      std::to_string(lines.size()) + " lines");
+
+        const std::size_t edited = layout.get_paragraph_count() / 2;
+        const int scroll = layout.get_line_bounds(edited, 0)->get_y();
+        layout.reset_stats();
+        const double incremental = bench::measure_ms(runs, [&] {
+            layout.insert_text(edited, 0, "x");
+            layout.get_lines(sdl::Rect(0, scroll, wrap_width, view_height), lines);
+        });
+        bench::report("incremental relayout per keystroke", incremental,
+                      std::to_string(layout.get_stats().shaped_paragraphs / (runs + 1)) + " paragraphs shaped/keystroke");
+    }
+
+    TTF_Quit();
+    return 0;
+}
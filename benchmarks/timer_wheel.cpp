@@ -0,0 +1,156 @@
+#include <SDL3pp/SDL.hpp>
+#include <SDL3/SDL_timer.h>
+#include <cstddef>
+#include <functional>
+#include <queue>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Keep 100k one-shot gameplay timers active over 10 s of 16 ms frames,
+// each expired timer being replaced and 1000 random timers cancelled and
+// replaced per frame, with a binary heap of deadlines and with
+// SDL3pp::TimerWheel. Then add and remove 10k timers through SDL_AddTimer
+// for reference.
+
+namespace
+{
+
+constexpr std::size_t timer_count = 100000;
+constexpr std::size_t frame_count = 625;
+constexpr Uint64 frame_ms = 16;
+constexpr std::size_t cancels_per_frame = 1000;
+constexpr std::size_t sdl_timer_count = 10000;
+constexpr std::size_t runs = 5;
+
+Uint32 SDLCALL on_sdl_timer(void*, SDL_TimerID, Uint32)
+{
+    return 0;
+}
+
+// Heap of deadlines, the cancelled timers being skipped when they surface
+class HeapTimers
+{
+public:
+    std::size_t add(Uint64 deadline, std::function<void()> callback)
+    {
+        const std::size_t id = m_callbacks.size();
+        m_callbacks.push_back(std::move(callback));
+        m_heap.push({deadline, id});
+        return id;
+    }
+
+    void cancel(std::size_t id)
+    {
+        m_callbacks[id] = nullptr;
+    }
+
+    void advance(Uint64 ticks)
+    {
+        while (!m_heap.empty() && m_heap.top().deadline <= ticks)
+        {
+            const std::size_t id = m_heap.top().id;
+            m_heap.pop();
+            if (m_callbacks[id])
+            {
+                std::function<void()> callback = std::move(m_callbacks[id]);
+                m_callbacks[id] = nullptr;
+                callback();
+            }
+        }
+    }
+
+private:
+    struct Entry
+    {
+        Uint64 deadline;
+        std::size_t id;
+
+        bool operator>(Entry const& other) const
+        {
+            return deadline > other.deadline;
+        }
+    };
+
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> m_heap;
+    std::vector<std::function<void()>> m_callbacks;
+};
+
+}
+
+int main()
+{
+    std::size_t fired = 0;
+
+    const double heap = bench::measure_ms(runs, [&] {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<Uint64> delay(1, 10000);
+        HeapTimers timers;
+        std::vector<std::size_t> ids(timer_count);
+        Uint64 ticks = 0;
+        std::function<void(std::size_t)> arm = [&](std::size_t slot) {
+            ids[slot] = timers.add(ticks + delay(rng), [&, slot] {
+                ++fired;
+                arm(slot);
+            });
+        };
+        for (std::size_t slot = 0; slot < timer_count; ++slot)
+            arm(slot);
+        for (std::size_t frame = 0; frame < frame_count; ++frame)
+        {
+            for (std::size_t i = 0; i < cancels_per_frame; ++i)
+            {
+                const std::size_t slot = rng() % timer_count;
+                timers.cancel(ids[slot]);
+                arm(slot);
+            }
+            ticks += frame_ms;
+            timers.advance(ticks);
+        }
+    });
+    bench::report("binary heap, lazy cancel", heap / frame_count,
+                  "per frame, " + std::to_string(fired / (runs + 1)) + " expiries");
+
+    fired = 0;
+    const double wheel = bench::measure_ms(runs, [&] {
+        std::mt19937 rng(42);
+        std::uniform_int_distribution<Uint64> delay(1, 10000);
+        sdl::TimerWheel timers(timer_count, 0);
+        std::vector<sdl::TimerHandle> handles(timer_count);
+        std::function<void(std::size_t)> arm = [&](std::size_t slot) {
+            handles[slot] = timers.add(delay(rng), [&, slot] {
+                ++fired;
+                arm(slot);
+            });
+        };
+        for (std::size_t slot = 0; slot < timer_count; ++slot)
+            arm(slot);
+        Uint64 ticks = 0;
+        for (std::size_t frame = 0; frame < frame_count; ++frame)
+        {
+            for (std::size_t i = 0; i < cancels_per_frame; ++i)
+            {
+                const std::size_t slot = rng() % timer_count;
+                timers.cancel(handles[slot]);
+                arm(slot);
+            }
+            ticks += frame_ms;
+            timers.advance(ticks);
+        }
+    });
+    bench::report("TimerWheel", wheel / frame_count,
+                  "per frame, " + std::to_string(fired / (runs + 1)) + " expiries");
+
+    const double sdl_timers = bench::measure_ms(runs, [&] {
+        std::vector<SDL_TimerID> ids(sdl_timer_count);
+        for (std::size_t i = 0; i < sdl_timer_count; ++i)
+            ids[i] = SDL_AddTimer(static_cast<Uint32>(60000 + i), &on_sdl_timer, nullptr);
+        for (const SDL_TimerID id : ids)
+            SDL_RemoveTimer(id);
+    });
+    bench::report("SDL_AddTimer + SDL_RemoveTimer", sdl_timers, std::to_string(sdl_timer_count) + " timers");
+
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include <SDL3pp/SDL.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Bench.hpp"
+
+// Mix 256 looping voices with ramping gains into 1024-frame stereo blocks,
+// first with a per-frame scalar loop, then with SDL3pp::VoiceMixer, and
+// report how many voices a 48 kHz output could sustain.
+
+namespace
+{
+
+constexpr std::size_t voice_count = 256;
+constexpr std::size_t block_frames = 1024;
+constexpr std::size_t sound_frames = 4801;
+constexpr std::size_t runs = 200;
+constexpr double frequency = 48000.;
+
+std::string voices_per_ms(double ms)
+{
+    const double voice_frames_per_ms = static_cast<double>(voice_count * block_frames) / ms;
+    return std::to_string(static_cast<std::size_t>(voice_frames_per_ms / static_cast<double>(block_frames)))
+         + " voice blocks/ms, " + std::to_string(static_cast<std::size_t>(voice_frames_per_ms * 1000. / frequency))
+         + " voices at 48 kHz";
+}
+
+}
+
+int main()
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> sample(-1.f, 1.f);
+    std::uniform_real_distribution<float> pan(-1.f, 1.f);
+    std::vector<float> sound(sound_frames);
+    for (float& value : sound)
+        value = sample(rng);
+
+    struct Naive
+    {
+        std::size_t position;
+        float gain;
+        float target;
+        float pan;
+    };
+    std::vector<Naive> naive_voices;
+    for (std::size_t i = 0; i < voice_count; ++i)
+        naive_voices.push_back({i * 17 % sound_frames, 1.f, 0.5f, pan(rng)});
+
+    std::vector<float> output(block_frames * 2);
+    const double naive = bench::measure_ms(runs, [&] {
+        std::fill(output.begin(), output.end(), 0.f);
+        for (Naive& voice : naive_voices)
+        {
+            const float step = (voice.target - voice.gain) / static_cast<float>(block_frames);
+            for (std::size_t i = 0; i < block_frames; ++i)
+            {
+                const float angle = (voice.pan + 1.f) * 0.785398f;
+                const float value = sound[voice.position] * voice.gain;
+                output[2 * i] += value * std::cos(angle);
+                output[2 * i + 1] += value * std::sin(angle);
+                voice.gain += step;
+                if (++voice.position == sound.size())
+                    voice.position = 0;
+            }
+            std::swap(voice.gain, voice.target);
+        }
+    });
+    bench::report("scalar per-frame mix", naive, voices_per_ms(naive));
+
+    sdl::VoiceMixer mixer(voice_count);
+    std::vector<sdl::VoiceHandle> handles;
+    for (std::size_t i = 0; i < voice_count; ++i)
+        handles.push_back(*mixer.play(sound, 1.f, pan(rng), true));
+    float gain = 0.5f;
+    const double mixed = bench::measure_ms(runs, [&] {
+        for (const sdl::VoiceHandle handle : handles)
+            mixer.set_gain(handle, gain, block_frames);
+        mixer.mix(output);
+        gain = 1.5f - gain;
+    });
+    bench::report("VoiceMixer::mix", mixed, voices_per_ms(mixed));
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+#ifndef SDL3PP_AUDIO_DECODER_HPP
+#define SDL3PP_AUDIO_DECODER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <SDL3/SDL_iostream.h>
+#include <SDL3pp/unique_handle.hpp>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Source of interleaved float32 frames decoded chunk by chunk
+ *
+ * A decoder only keeps what it needs to decode the next chunk, so a track
+ * can be played without ever being resident in memory. MusicStream calls
+ * the decoder from its background thread: a decoder is used by one thread
+ * at a time, but not always the one which created it.
+ */
+class AudioDecoder
+{
+public:
+    AudioDecoder() = default;
+
+    AudioDecoder(AudioDecoder const&) = delete;
+    AudioDecoder& operator=(AudioDecoder const&) = delete;
+
+    virtual ~AudioDecoder() = default;
+
+    virtual int get_channels() const noexcept = 0;
+
+    virtual int get_frequency() const noexcept = 0;
+
+    /**
+     * @brief Decode the next frames
+     *
+     * @param samples the interleaved samples to fill, the number of samples
+     *                is rounded down to whole frames.
+     * @returns the number of frames decoded, 0 at the end of the track or on
+     *          error.
+     */
+    virtual std::size_t decode(std::span<float> samples) noexcept = 0;
+
+    /**
+     * @brief Go back to the first frame of the track
+     *
+     * @returns false on error.
+     */
+    virtual bool rewind() noexcept = 0;
+};
+
+/**
+ * @brief Streaming decoder of WAV files
+ *
+ * Integer PCM of 8, 16, 24 and 32 bits and float32 samples are supported,
+ * including the WAVE_FORMAT_EXTENSIBLE layout. Only the header is parsed up
+ * front; the samples are read from the SDL_IOStream as they are decoded,
+ * through a buffer allocated with the object, so decode() never allocates.
+ */
+class WavDecoder : public AudioDecoder
+{
+public:
+    WavDecoder() = delete;
+
+    /**
+     * @brief Construct a new WavDecoder object from a WAV file
+     *
+     * @param file the path of the WAV file.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    explicit WavDecoder(std::string const& file);
+
+    /**
+     * @brief Construct a new WavDecoder object from an SDL_IOStream
+     *
+     * @param stream the stream to read, it is closed with the object, or at
+     *               once when an exception is thrown.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    explicit WavDecoder(SDL_IOStream* stream);
+
+    WavDecoder(WavDecoder const&) = delete;
+    WavDecoder& operator=(WavDecoder const&) = delete;
+
+    ~WavDecoder() override = default;
+
+    inline int get_channels() const noexcept override;
+
+    inline int get_frequency() const noexcept override;
+
+    /**
+     * @brief Get the number of frames of the track
+     */
+    inline std::size_t get_length() const noexcept;
+
+    std::size_t decode(std::span<float> samples) noexcept override;
+
+    bool rewind() noexcept override;
+
+private:
+    void parse_header();
+
+    unique_handle<SDL_IOStream, &SDL_CloseIO> m_stream;
+    int m_channels;
+    int m_frequency;
+    int m_bits;
+    bool m_float;
+    std::int64_t m_data_offset;
+    std::size_t m_length;
+    std::size_t m_position;
+    std::vector<std::uint8_t> m_raw;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/AudioDecoder.inl"
+#endif
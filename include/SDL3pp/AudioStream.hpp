@@ -0,0 +1,201 @@
+#ifndef SDL3PP_AUDIO_STREAM_HPP
+#define SDL3PP_AUDIO_STREAM_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include <SDL3/SDL_audio.h>
+#include <SDL3pp/SpscRing.hpp>
+#include <SDL3pp/unique_handle.hpp>
+
+namespace SDL3pp
+{
+
+using AudioDeviceID = SDL_AudioDeviceID;
+using AudioSpec = SDL_AudioSpec;
+
+/**
+ * @brief Counters of an AudioStream
+ *
+ * The counters are accumulated until AudioStream::reset_stats() is called.
+ */
+struct AudioStreamStats
+{
+    /** Number of device requests which could not be fully served. */
+    std::size_t underruns = 0;
+    /** Number of silent frames sent to the device on underruns. */
+    std::size_t underrun_frames = 0;
+    /** Number of write() calls which did not fit in the ring. */
+    std::size_t overruns = 0;
+    /** Number of frames dropped by write() on overruns. */
+    std::size_t overrun_frames = 0;
+    /** Number of frames sent from the ring to the device. */
+    std::size_t played_frames = 0;
+    /** Audio queued ahead of the device at its last request. */
+    std::chrono::nanoseconds latency {0};
+    std::chrono::nanoseconds min_latency {0};
+    std::chrono::nanoseconds max_latency {0};
+    std::chrono::nanoseconds average_latency {0};
+};
+
+/**
+ * @brief Playback stream fed from a wait-free ring buffer
+ *
+ * The stream opens an audio device with an SDL_AudioStream in
+ * interleaved float32 format. One producer thread, typically the game
+ * thread, writes frames into an SpscRing, and the SDL audio thread moves
+ * them to the device from the get-callback of the stream. Neither side
+ * ever takes a lock, so a preempted producer can not stall the audio
+ * thread.
+ *
+ * When the ring is empty the callback pads the device request with silence
+ * and counts an underrun. When the ring is full write() drops the frames
+ * which do not fit and counts an overrun. The latency is the audio queued
+ * in the ring and in the SDL_AudioStream when the device asks for more.
+ *
+ * The device starts paused, so the ring can be primed before resume().
+ * Without any audio hardware, set the SDL_HINT_AUDIO_DRIVER hint to "dummy"
+ * or "disk" before initializing the audio subsystem: both drivers consume
+ * the stream in real time.
+ *
+ * @code {.cpp}
+ * SDL3pp::AudioStream stream(2, 48000, 4096);
+ * stream.write(first_block);
+ * stream.resume();
+ *
+ * // game thread, each frame
+ * stream.write(mixed_samples);
+ * @endcode
+ *
+ * @see https://wiki.libsdl.org/SDL3/SDL_OpenAudioDeviceStream
+ */
+class AudioStream
+{
+public:
+    AudioStream() = delete;
+
+    /**
+     * @brief Construct a new AudioStream object on an audio device
+     *
+     * @param channels the number of interleaved channels.
+     * @param frequency the sample rate in Hz.
+     * @param capacity the number of frames the ring can hold at least.
+     * @param device the device to open.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    AudioStream(int channels, int frequency, std::size_t capacity,
+                AudioDeviceID device = SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK);
+
+    AudioStream(AudioStream const&) = delete;
+    AudioStream& operator=(AudioStream const&) = delete;
+
+    // The audio callback keeps the address of the object
+    AudioStream(AudioStream&&) = delete;
+    AudioStream& operator=(AudioStream&&) = delete;
+
+    ~AudioStream();
+
+    /**
+     * @brief Queue interleaved frames
+     *
+     * The frames which do not fit in the ring are dropped.
+     *
+     * @param samples the samples, the number of samples is rounded down to
+     *                whole frames.
+     * @returns the number of frames queued.
+     *
+     * @threadsafety This function should only be called by the producer.
+     */
+    std::size_t write(std::span<const float> samples) noexcept;
+
+    /**
+     * @brief Get the number of frames write() can queue without dropping
+     */
+    inline std::size_t get_writable_frames() const noexcept;
+
+    /**
+     * @brief Get the number of frames waiting in the ring
+     */
+    inline std::size_t get_buffered_frames() const noexcept;
+
+    /**
+     * @brief Pause the audio device
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    inline void pause();
+
+    /**
+     * @brief Resume the audio device
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    inline void resume();
+
+    inline bool is_paused() const noexcept;
+
+    inline int get_channels() const noexcept;
+
+    inline int get_frequency() const noexcept;
+
+    /**
+     * @brief Get the capacity of the ring, in frames
+     */
+    inline std::size_t get_capacity() const noexcept;
+
+    /**
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    AudioStreamStats get_stats() const noexcept;
+
+    /**
+     * @threadsafety This function should only be called by the producer.
+     */
+    void reset_stats() noexcept;
+
+    /**
+     * @brief Get the underlying SDL_AudioStream
+     *
+     * The ownership is kept by the AudioStream object.
+     */
+    inline SDL_AudioStream* get() const noexcept;
+
+private:
+    static void SDLCALL on_get(void* userdata, SDL_AudioStream* stream, int additional_amount, int total_amount);
+    void feed(int additional_amount, int total_amount) noexcept;
+    std::int64_t frames_to_ns(std::size_t frames) const noexcept;
+
+    int m_channels;
+    int m_frequency;
+    SpscRing<float> m_ring;
+    std::unique_ptr<float[]> m_scratch;
+    std::size_t m_scratch_frames;
+    unique_handle<SDL_AudioStream, &SDL_DestroyAudioStream> m_stream;
+
+    // Written by the producer
+    std::atomic<std::size_t> m_overruns {0};
+    std::atomic<std::size_t> m_overrun_frames {0};
+    std::atomic<bool> m_reset_requested {false};
+
+    // Written by the audio callback
+    std::atomic<std::size_t> m_underruns {0};
+    std::atomic<std::size_t> m_underrun_frames {0};
+    std::atomic<std::size_t> m_played_frames {0};
+    std::atomic<std::size_t> m_requests {0};
+    std::atomic<std::int64_t> m_latency {0};
+    std::atomic<std::int64_t> m_min_latency {0};
+    std::atomic<std::int64_t> m_max_latency {0};
+    std::atomic<std::int64_t> m_total_latency {0};
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/AudioStream.inl"
+#endif
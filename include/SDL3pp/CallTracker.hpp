@@ -0,0 +1,191 @@
+#ifndef SDL3PP_CALL_TRACKER_HPP
+#define SDL3PP_CALL_TRACKER_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3pp/Config.hpp>
+
+namespace SDL3pp
+{
+
+/** Number of buckets of the latency histograms, powers of two of nanoseconds. */
+inline constexpr std::size_t call_histogram_size = 32;
+
+/**
+ * @brief Counters of an SDL function called by the wrapper
+ */
+struct CallStats
+{
+    /** Name of the SDL function, a string with static storage duration. */
+    const char* name = nullptr;
+    /** Number of calls. */
+    std::uint64_t calls = 0;
+    /** Time spent in the calls, in nanoseconds. */
+    std::uint64_t total_ns = 0;
+    /** Longest call, in nanoseconds. */
+    std::uint64_t max_ns = 0;
+    /**
+     * Number of calls per latency: bucket 0 counts the calls under 2 ns,
+     * bucket i > 0 those between 2^i and 2^(i+1) ns, the last one also
+     * counting the longer calls.
+     */
+    std::array<std::uint64_t, call_histogram_size> histogram {};
+
+    /**
+     * @brief Get an upper bound of a percentile of the latency
+     *
+     * @param percentile between 0 and 100.
+     *
+     * @returns the upper bound, in nanoseconds, of the histogram bucket
+     *          holding the percentile, or 0 without calls.
+     */
+    std::uint64_t get_percentile_ns(double percentile) const noexcept;
+};
+
+/**
+ * @brief Counters of an SDL function, shared by every call site of the function
+ */
+class CallSite
+{
+public:
+    CallSite() = delete;
+
+    explicit CallSite(const char* name) noexcept;
+
+    CallSite(CallSite const&) = delete;
+    CallSite& operator=(CallSite const&) = delete;
+
+    CallSite(CallSite&&) = delete;
+    CallSite& operator=(CallSite&&) = delete;
+
+    ~CallSite() = default;
+
+private:
+    friend class CallTracker;
+
+    const char* m_name;
+    std::atomic<std::uint64_t> m_calls {0};
+    std::atomic<std::uint64_t> m_total_ns {0};
+    std::atomic<std::uint64_t> m_max_ns {0};
+    std::array<std::atomic<std::uint64_t>, call_histogram_size> m_histogram {};
+};
+
+/**
+ * @brief Opt-in accounting of the SDL functions called by the wrapper
+ *
+ * The classes of SDL3pp make their SDL calls through SDL3PP_CALL(), which
+ * counts each call and adds its latency, measured with
+ * SDL_GetPerformanceCounter(), to the histogram of the function. The calls
+ * are only accounted when SDL3PP_WITH_CALL_STATS is defined, by the CMake
+ * option of the same name: otherwise SDL3PP_CALL() is a plain call, and
+ * the tracker always comes back empty.
+ *
+ * Every SDL, SDL_image and SDL_ttf function called by the classes of
+ * SDL3pp is accounted, except:
+ * - SDL_SetError() and SDL_GetError(), which report the errors;
+ * - the destroy functions given to unique_handle, called by its deleter;
+ * - the header-only helpers of Point and Rect, and pure computations
+ *   such as SDL_StepUTF8();
+ * - the calls of CallTracker, Profiler and MemoryTracker themselves.
+ *
+ * The counters cover the frame in progress: next_frame() returns them and
+ * starts the next frame from zero, so that a slow frame can be explained
+ * by the functions it called, such as SDL_GetWindowSize() called 900 times.
+ *
+ * @code {.cpp}
+ * // main loop, each frame
+ * for (SDL3pp::CallStats const& stats : SDL3pp::CallTracker::next_frame())
+ *     SDL_Log("%s: %llu calls, p99 %llu ns", stats.name, stats.calls, stats.get_percentile_ns(99.));
+ * @endcode
+ */
+class CallTracker
+{
+public:
+    CallTracker() = delete;
+
+    /**
+     * @brief Get the counters of a function, registered on the first call
+     *
+     * @param name the name of the function, a string with static storage duration.
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    static CallSite& get_site(const char* name);
+
+    /**
+     * @brief Get the counters of the functions called during the frame in progress
+     *
+     * @returns the counters, sorted by decreasing number of calls.
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    static std::vector<CallStats> get_stats();
+
+    /**
+     * @brief End the current frame and start the next one
+     *
+     * @returns the counters of the ended frame, sorted by decreasing number
+     *          of calls.
+     *
+     * @threadsafety This function should only be called by the main thread.
+     */
+    static std::vector<CallStats> next_frame();
+
+    /**
+     * @brief Account a call of the function of a site
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    static void record(CallSite& site, Uint64 start, Uint64 end) noexcept;
+};
+
+/**
+ * @brief Call timed by the CallTracker, used by SDL3PP_CALL()
+ */
+class CallTimer
+{
+public:
+    CallTimer() = delete;
+
+    inline explicit CallTimer(CallSite& site) noexcept;
+
+    CallTimer(CallTimer const&) = delete;
+    CallTimer& operator=(CallTimer const&) = delete;
+
+    CallTimer(CallTimer&&) = delete;
+    CallTimer& operator=(CallTimer&&) = delete;
+
+    inline ~CallTimer();
+
+private:
+    CallSite& m_site;
+    Uint64 m_start;
+};
+
+} // namespace SDL3pp
+
+/**
+ * @brief Call the SDL function function with the arguments, accounted by the CallTracker
+ *
+ * The timer lives until the end of the full expression, so it also covers
+ * the test of the result, as in `if (!SDL3PP_CALL(SDL_Foo, x))`. Without
+ * SDL3PP_WITH_CALL_STATS, it expands to function(...).
+ */
+#ifdef SDL3PP_WITH_CALL_STATS
+#define SDL3PP_CALL(function, ...)                                                                  \
+    (static_cast<void>(::SDL3pp::CallTimer([]() -> ::SDL3pp::CallSite& {                            \
+         static ::SDL3pp::CallSite& sdl3pp_site = ::SDL3pp::CallTracker::get_site(#function);       \
+         return sdl3pp_site;                                                                        \
+     }())),                                                                                         \
+     function(__VA_ARGS__))
+#else
+#define SDL3PP_CALL(function, ...) function(__VA_ARGS__)
+#endif
+
+#include "inline_src/CallTracker.inl"
+#endif
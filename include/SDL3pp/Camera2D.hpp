@@ -0,0 +1,163 @@
+#ifndef SDL3PP_CAMERA_2D_HPP
+#define SDL3PP_CAMERA_2D_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <SDL3pp/Point.hpp>
+#include <SDL3pp/Rect.hpp>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief 2D camera mapping world coordinates to screen coordinates
+ *
+ * The camera owns a world-space viewport, the area of the world which is
+ * visible, a zoom factor and a screen-space offset where the viewport is
+ * drawn. A world point p is drawn at:
+ *
+ * @code
+ * offset + (p - viewport.top_left) * zoom
+ * @endcode
+ *
+ * Besides the single element conversions, the camera transforms whole
+ * spans of points and rects. The transform_visible() functions fuse the
+ * visibility test with the transform: they write the screen coordinates
+ * and the source indices of the visible elements only, in one branchless
+ * pass over the input.
+ */
+class Camera2D
+{
+public:
+    Camera2D() = delete;
+
+    /**
+     * @brief Construct a new Camera2D object
+     *
+     * @param viewport the world-space area visible through the camera.
+     * @param zoom the scale factor from world to screen units, must be
+     *             strictly positive.
+     * @param offset the screen position of the viewport top left corner.
+     */
+    explicit Camera2D(Rect const& viewport, float zoom = 1.f, Point const& offset = Point()) noexcept;
+
+    Camera2D(Camera2D const&) = default;
+    Camera2D& operator=(Camera2D const&) = default;
+
+    Camera2D(Camera2D&&) = default;
+    Camera2D& operator=(Camera2D&&) = default;
+
+    ~Camera2D() = default;
+
+    inline Rect const& get_viewport() const noexcept;
+
+    inline void set_viewport(Rect const& viewport) noexcept;
+
+    inline float get_zoom() const noexcept;
+
+    inline void set_zoom(float zoom) noexcept;
+
+    /**
+     * @brief Change the zoom while keeping the screen size and the center
+     *        of the viewport
+     *
+     * The world-space viewport is resized accordingly.
+     *
+     * @param zoom the new zoom factor, must be strictly positive.
+     */
+    void zoom_to(float zoom) noexcept;
+
+    inline Point const& get_offset() const noexcept;
+
+    inline void set_offset(Point const& offset) noexcept;
+
+    /**
+     * @brief Move the viewport by a world-space offset
+     */
+    inline void move_by(Point const& delta) noexcept;
+
+    /**
+     * @brief Center the viewport on a world-space position
+     */
+    inline void center_on(Point const& position) noexcept;
+
+    /**
+     * @brief Get the screen-space area covered by the viewport
+     */
+    inline Rect get_screen_rect() const noexcept;
+
+    inline bool is_visible(Point const& point) const noexcept;
+
+    inline bool is_visible(Rect const& rect) const noexcept;
+
+    inline Point world_to_screen(Point const& point) const noexcept;
+
+    /**
+     * @brief Convert a world rect to screen coordinates
+     *
+     * Both corners are converted, so rects sharing an edge in the world
+     * still share an edge on the screen whatever the zoom.
+     */
+    inline Rect world_to_screen(Rect const& rect) const noexcept;
+
+    inline Point screen_to_world(Point const& point) const noexcept;
+
+    /**
+     * @brief Convert a span of world points to screen coordinates
+     *
+     * @param world the points to convert.
+     * @param screen the output, at least as large as world.
+     */
+    void transform(std::span<const Point> world, std::span<Point> screen) const noexcept;
+
+    /**
+     * @brief Convert a span of world rects to screen coordinates
+     *
+     * @param world the rects to convert.
+     * @param screen the output, at least as large as world.
+     */
+    void transform(std::span<const Rect> world, std::span<Rect> screen) const noexcept;
+
+    /**
+     * @brief Convert the visible world points to screen coordinates
+     *
+     * @param world the points to convert.
+     * @param screen the screen coordinates of the visible points, at least
+     *               as large as world.
+     * @param indices the indices in world of the visible points, at least
+     *                as large as world.
+     *
+     * @returns the number of visible points written to screen and indices.
+     */
+    std::size_t transform_visible(std::span<const Point> world, std::span<Point> screen,
+                                  std::span<std::uint32_t> indices) const noexcept;
+
+    /**
+     * @brief Convert the visible world rects to screen coordinates
+     *
+     * @param world the rects to convert.
+     * @param screen the screen coordinates of the visible rects, at least
+     *               as large as world.
+     * @param indices the indices in world of the visible rects, at least
+     *                as large as world.
+     *
+     * @returns the number of visible rects written to screen and indices.
+     */
+    std::size_t transform_visible(std::span<const Rect> world, std::span<Rect> screen,
+                                  std::span<std::uint32_t> indices) const noexcept;
+
+private:
+    inline int to_screen_x(int x) const noexcept;
+    inline int to_screen_y(int y) const noexcept;
+
+    Rect m_viewport;
+    float m_zoom;
+    Point m_offset;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/Camera2D.inl"
+#endif
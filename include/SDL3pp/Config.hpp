@@ -10,5 +10,7 @@
 #define SDL3PP_WITH_IMAGE
 #define SDL3PP_WITH_TTF
 #define SDL3PP_WITH_MIXER
+/* #undef SDL3PP_WITH_PROFILER */
+/* #undef SDL3PP_WITH_CALL_STATS */
 
 #endif
@@ -0,0 +1,96 @@
+#ifndef SDL3PP_COROUTINE_FRAME_POOL_HPP
+#define SDL3PP_COROUTINE_FRAME_POOL_HPP
+
+#include <cstddef>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Counters of the CoroutineFramePool of a thread
+ */
+struct CoroutineFramePoolStats
+{
+    /** Number of frames allocated. */
+    std::size_t allocations = 0;
+    /** Number of allocations served by a recycled block. */
+    std::size_t recycled_allocations = 0;
+    /** Number of allocations which went to the heap. */
+    std::size_t heap_allocations = 0;
+    /** Number of free blocks kept for reuse. */
+    std::size_t cached_blocks = 0;
+};
+
+/**
+ * @brief Recycling allocator of coroutine frames
+ *
+ * The frames of Task coroutines are allocated here instead of with
+ * operator new. Their sizes are rounded up to a multiple of granularity,
+ * and a freed frame goes to a free list of its size class instead of going
+ * back to the heap, so once a coroutine of a given size has run, starting
+ * another one costs a few pointer moves.
+ *
+ * The free lists belong to the calling thread, so no lock is taken: a frame
+ * freed by another thread than the one which allocated it simply joins the
+ * lists of the freeing thread. A thread frees its blocks when it exits.
+ * Frames larger than the largest size class bypass the pool.
+ */
+class CoroutineFramePool
+{
+public:
+    /** Size step of the size classes, in bytes. */
+    static constexpr std::size_t granularity = 64;
+    /** Number of size classes, the largest one being granularity * class_count bytes. */
+    static constexpr std::size_t class_count = 32;
+    /** Maximum size of the free blocks kept per size class and per thread, in bytes. */
+    static constexpr std::size_t max_cached_bytes = 4 << 20;
+
+    CoroutineFramePool() = delete;
+
+    /**
+     * @brief Allocate a coroutine frame
+     *
+     * @param size the size of the frame, in bytes.
+     * @returns the frame, aligned for any standard type.
+     *
+     * @exception std::bad_alloc if the heap is exhausted
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    static void* allocate(std::size_t size);
+
+    /**
+     * @brief Free a coroutine frame
+     *
+     * @param frame the frame returned by allocate().
+     * @param size the size given to allocate().
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    static void deallocate(void* frame, std::size_t size) noexcept;
+
+    /**
+     * @brief Fill the free lists of the calling thread ahead of time
+     *
+     * @param size the size of the frames, in bytes.
+     * @param count the number of free blocks wanted for this size.
+     *
+     * @exception std::bad_alloc if the heap is exhausted
+     */
+    static void reserve(std::size_t size, std::size_t count);
+
+    /**
+     * @brief Get the counters of the calling thread
+     */
+    static CoroutineFramePoolStats get_stats() noexcept;
+
+    static void reset_stats() noexcept;
+
+private:
+    inline static constexpr std::size_t get_size_class(std::size_t size) noexcept;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/CoroutineFramePool.inl"
+#endif
@@ -0,0 +1,136 @@
+#ifndef SDL3PP_EVENT_COALESCER_HPP
+#define SDL3PP_EVENT_COALESCER_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include <SDL3/SDL_events.h>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Event types merged by an EventCoalescer
+ */
+struct EventCoalescerConfig
+{
+    /** Merge the SDL_EVENT_MOUSE_MOTION events. */
+    bool mouse_motion = true;
+    /** Merge the SDL_EVENT_MOUSE_WHEEL events. */
+    bool mouse_wheel = true;
+};
+
+/**
+ * @brief Counters of an EventCoalescer
+ */
+struct EventCoalescerStats
+{
+    /** Number of pumps which merged events. */
+    std::size_t coalesced_pumps = 0;
+    /** Number of SDL_EVENT_MOUSE_MOTION events merged into a previous one. */
+    std::size_t dropped_motion_events = 0;
+    /** Number of SDL_EVENT_MOUSE_WHEEL events merged into a previous one. */
+    std::size_t dropped_wheel_events = 0;
+};
+
+/**
+ * @brief Merge the mouse motion and wheel events of a pump, per window and mouse
+ *
+ * A mouse polled at 1000 Hz or more sends many motion events per frame,
+ * each of them handled by the application. pump() pumps the events, then
+ * merges the motion events of a window and a mouse into one: the first
+ * of them, with the position, the buttons and the timestamp of the last
+ * and the sum of the relative motions, which is exact. The wheel events
+ * are merged the same way, per scrolling direction.
+ *
+ * The events are merged as long as no other event comes between them, so
+ * that the order of the motions with the buttons and the keys is kept:
+ * a click still happens where it happened. The queue is taken and put
+ * back with SDL_PeepEvents(), which an event filter can not do: a filter
+ * sees the events one at a time, and can not amend one already queued.
+ * The events pushed by other threads during the pump end up ahead of the
+ * events of the queue.
+ *
+ * @code {.cpp}
+ * SDL3pp::EventCoalescer coalescer;
+ * // main loop
+ * while (running)
+ * {
+ *     coalescer.pump();
+ *     while (SDL_PollEvent(&event)) { ... }
+ * }
+ * @endcode
+ *
+ * @see https://wiki.libsdl.org/SDL3/SDL_PeepEvents
+ */
+class EventCoalescer
+{
+public:
+    /**
+     * @brief Construct a new EventCoalescer object
+     *
+     * @param config the event types to merge.
+     */
+    explicit EventCoalescer(EventCoalescerConfig const& config = {});
+
+    EventCoalescer(EventCoalescer const&) = delete;
+    EventCoalescer& operator=(EventCoalescer const&) = delete;
+
+    EventCoalescer(EventCoalescer&&) = default;
+    EventCoalescer& operator=(EventCoalescer&&) = default;
+
+    ~EventCoalescer() = default;
+
+    /**
+     * @brief Pump the events and merge the motion and wheel events of the queue
+     *
+     * The queue is left untouched when it holds at most one mouse event.
+     *
+     * @returns the number of events dropped by this pump.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     * @threadsafety This function should only be called by the main thread.
+     */
+    std::size_t pump();
+
+    /**
+     * @brief Change the event types to merge, from the next pump
+     */
+    inline void set_config(EventCoalescerConfig const& config) noexcept;
+
+    /**
+     * @brief Get the event types to merge
+     */
+    inline EventCoalescerConfig const& get_config() const noexcept;
+
+    /**
+     * @brief Get the counters of the coalescer
+     */
+    inline EventCoalescerStats const& get_stats() const noexcept;
+
+    /**
+     * @brief Get the number of events dropped since the construction, of all types
+     */
+    inline std::size_t get_dropped_events() const noexcept;
+
+private:
+    // Merged event of a run, with its relative motion summed in double
+    struct Run
+    {
+        std::size_t index;
+        double x;
+        double y;
+    };
+
+    bool is_merged(Uint32 type) const noexcept;
+
+    EventCoalescerConfig m_config;
+    EventCoalescerStats m_stats;
+    std::vector<SDL_Event> m_events;
+    std::vector<Run> m_runs;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/EventCoalescer.inl"
+#endif
@@ -0,0 +1,309 @@
+#ifndef SDL3PP_EVENT_LOG_HPP
+#define SDL3PP_EVENT_LOG_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <SDL3/SDL_events.h>
+#include <SDL3/SDL_iostream.h>
+#include <SDL3pp/unique_handle.hpp>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Counters of an EventRecorder
+ */
+struct EventRecorderStats
+{
+    /** Number of events appended to the log. */
+    std::size_t recorded_events = 0;
+    /** Number of bytes appended to the log, buffered ones included. */
+    std::size_t recorded_bytes = 0;
+    /** Number of strings cut to the maximum size of a record. */
+    std::size_t truncated_strings = 0;
+};
+
+/**
+ * @brief Writer of a binary log of the SDL events, with their timestamps
+ *
+ * Once started, the recorder watches the event queue with
+ * SDL_AddEventWatch() and appends each event pumped or pushed to the log,
+ * with the time elapsed since start(). The log is a 16 byte file header,
+ * the magic "SDL3PPEV", the format version and sizeof(SDL_Event), followed
+ * by one record per event:
+ *
+ * - the time of the event in nanoseconds since the start, on 64 bits,
+ * - the size of the event, then of its two strings, on 16 bits each,
+ *   and 16 reserved bits,
+ * - the bytes of the event, without its trailing zeros,
+ * - the strings of the event, such as the text of SDL_EVENT_TEXT_INPUT or
+ *   the path of SDL_EVENT_DROP_FILE, with their terminating null
+ *   characters. A size of zero is a null pointer.
+ *
+ * The log is in the byte order of the machine and only ever appended to:
+ * a recording cut short, by a crash for instance, is still readable up to
+ * its last complete record. The records are buffered and written when the
+ * buffer is full, on flush() and on stop().
+ *
+ * Pointers other than strings, such as the data of the user events and the
+ * candidates of SDL_EVENT_TEXT_EDITING_CANDIDATES, are recorded as null
+ * pointers.
+ *
+ * @code {.cpp}
+ * SDL3pp::EventRecorder recorder("session.events");
+ * recorder.start();
+ * // main loop
+ * while (SDL_PollEvent(&event)) { ... }
+ * // at exit
+ * recorder.stop();
+ * @endcode
+ *
+ * @see EventPlayer
+ * @see https://wiki.libsdl.org/SDL3/SDL_AddEventWatch
+ */
+class EventRecorder
+{
+public:
+    /** Size of the buffer of records, written once full. */
+    static constexpr std::size_t buffer_size = 64 * 1024;
+
+    EventRecorder() = delete;
+
+    /**
+     * @brief Create the log file and write its header
+     *
+     * An existing file is replaced.
+     *
+     * @param file the path of the log.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    explicit EventRecorder(std::string const& file);
+
+    EventRecorder(EventRecorder const&) = delete;
+    EventRecorder& operator=(EventRecorder const&) = delete;
+
+    // The event watch keeps the address of the object
+    EventRecorder(EventRecorder&&) = delete;
+    EventRecorder& operator=(EventRecorder&&) = delete;
+
+    /**
+     * @brief Stop the recording and write the buffered records
+     *
+     * A failed write is lost silently: call stop() first to be told.
+     */
+    ~EventRecorder();
+
+    /**
+     * @brief Watch the event queue and take the start of the recording as time zero
+     *
+     * The events pushed by an EventPlayer are recorded too: do not record
+     * a replay into the log it is read from.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     * @threadsafety This function should only be called by the main thread.
+     */
+    void start();
+
+    /**
+     * @brief Stop watching the event queue and write the buffered records
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     * @threadsafety This function should only be called by the main thread.
+     */
+    void stop();
+
+    /**
+     * @brief Check whether the recorder watches the event queue
+     */
+    inline bool is_recording() const noexcept;
+
+    /**
+     * @brief Append an event to the log
+     *
+     * Done by the event watch for each event while recording; call it
+     * directly to record events which do not go through the queue. An
+     * event without a timestamp is stamped with the current time.
+     *
+     * @param event the event, whose strings are copied.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    void record(SDL_Event const& event);
+
+    /**
+     * @brief Write the buffered records to the file
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this,
+     *            also thrown for the failed writes of the event watch.
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    void flush();
+
+    /**
+     * @brief Get the counters of the recorder
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    EventRecorderStats get_stats() const;
+
+private:
+    static bool SDLCALL on_event(void* userdata, SDL_Event* event);
+
+    void append(SDL_Event const& event);
+    bool write_buffer() noexcept;
+
+    unique_handle<SDL_IOStream, &SDL_CloseIO> m_stream;
+    mutable std::mutex m_mutex;
+    std::vector<std::byte> m_buffer;
+    Uint64 m_origin;
+    bool m_recording;
+    bool m_write_failed;
+    EventRecorderStats m_stats;
+};
+
+/**
+ * @brief Speed of an EventPlayer
+ */
+enum class PlaybackMode
+{
+    /** The events are pushed at the times they were recorded at. */
+    real_time,
+    /** The events are pushed as fast as the queue takes them. */
+    as_fast_as_possible
+};
+
+/**
+ * @brief Counters of an EventPlayer
+ */
+struct EventPlayerStats
+{
+    /** Number of events pushed to the queue. */
+    std::size_t pushed_events = 0;
+    /** Number of events refused by SDL_PushEvent(), filtered or not queued. */
+    std::size_t rejected_events = 0;
+};
+
+/**
+ * @brief Reader of a log of an EventRecorder, which pushes its events to the queue
+ *
+ * The log is memory-mapped: its records are read in place and the strings
+ * of the events point into the mapping, without a copy, so they are valid
+ * as long as the player. The log is checked when opened, and ends at its
+ * last complete record.
+ *
+ * update(), called once per frame before the events are polled, pushes
+ * the events due with SDL_PushEvent(), which stamps them with the current
+ * time. In real time, an event is due once the time elapsed since the
+ * first update reaches its recorded time; as fast as possible, all the
+ * events are due at once. Either way, an update pushes at most a batch of
+ * events, so that the queue of SDL, 65535 events long, does not overflow:
+ * the late events are pushed by the next updates.
+ *
+ * This replays a recorded session headless, to benchmark the event path
+ * of an application under a realistic load.
+ *
+ * @code {.cpp}
+ * SDL3pp::EventPlayer player("session.events", SDL3pp::PlaybackMode::as_fast_as_possible);
+ * // main loop
+ * while (!player.is_finished())
+ * {
+ *     player.update();
+ *     while (SDL_PollEvent(&event)) { ... }
+ * }
+ * @endcode
+ *
+ * @see EventRecorder
+ * @see https://wiki.libsdl.org/SDL3/SDL_PushEvent
+ */
+class EventPlayer
+{
+public:
+    /** Default number of events pushed by an update. */
+    static constexpr std::size_t default_batch = 4096;
+
+    EventPlayer() = delete;
+
+    /**
+     * @brief Map a log and check its records
+     *
+     * @param file the path of the log.
+     * @param mode the speed of the playback.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    explicit EventPlayer(std::string const& file, PlaybackMode mode = PlaybackMode::real_time);
+
+    EventPlayer(EventPlayer const&) = delete;
+    EventPlayer& operator=(EventPlayer const&) = delete;
+
+    // Events in the queue may point into the mapping
+    EventPlayer(EventPlayer&&) = delete;
+    EventPlayer& operator=(EventPlayer&&) = delete;
+
+    ~EventPlayer();
+
+    /**
+     * @brief Push the events due to the queue
+     *
+     * The first call starts the playback.
+     *
+     * @param batch the maximum number of events to push.
+     * @returns the number of events pushed.
+     *
+     * @threadsafety This function should only be called by the main thread.
+     */
+    std::size_t update(std::size_t batch = default_batch) noexcept;
+
+    /**
+     * @brief Start the playback over, at the next update
+     */
+    void rewind() noexcept;
+
+    /**
+     * @brief Check whether all the events have been pushed
+     */
+    inline bool is_finished() const noexcept;
+
+    /**
+     * @brief Get the speed of the playback
+     */
+    inline PlaybackMode get_mode() const noexcept;
+
+    /**
+     * @brief Get the number of events of the log
+     */
+    inline std::size_t get_event_count() const noexcept;
+
+    /**
+     * @brief Get the recorded time of the last event, in nanoseconds
+     */
+    inline Uint64 get_duration_ns() const noexcept;
+
+    /**
+     * @brief Get the counters of the player
+     */
+    inline EventPlayerStats const& get_stats() const noexcept;
+
+private:
+    std::span<const std::byte> m_log;
+    std::size_t m_end;
+    std::size_t m_cursor;
+    std::size_t m_event_count;
+    Uint64 m_duration_ns;
+    Uint64 m_start;
+    bool m_started;
+    PlaybackMode m_mode;
+    EventPlayerStats m_stats;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/EventLog.inl"
+#endif
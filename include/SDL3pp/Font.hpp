@@ -0,0 +1,172 @@
+#ifndef SDL3PP_FONT_HPP
+#define SDL3PP_FONT_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include <SDL3_ttf/SDL_ttf.h>
+#include <SDL3pp/Surface.hpp>
+#include <SDL3pp/unique_handle.hpp>
+
+namespace SDL3pp
+{
+
+using FontStyle = TTF_FontStyleFlags;
+
+/**
+ * @brief Metrics of a glyph, in pixels
+ *
+ * The y axis goes up from the baseline.
+ */
+struct GlyphMetrics
+{
+    int min_x = 0;
+    int max_x = 0;
+    int min_y = 0;
+    int max_y = 0;
+    int advance = 0;
+};
+
+/**
+ * @brief TrueType font of SDL3_ttf
+ *
+ * TTF_Init() must have been called before any font is opened.
+ *
+ * @see https://wiki.libsdl.org/SDL3_ttf/CategorySDLTTF
+ */
+class Font
+{
+public:
+    Font() = delete;
+
+    /**
+     * @brief Construct a new Font object from a font file
+     *
+     * @param file the path of the font file.
+     * @param size the point size of the font.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    Font(std::string const& file, float size);
+
+    /**
+     * @brief Take the ownership of an existing TTF_Font
+     *
+     * @param font the font to own, it is closed with the object.
+     */
+    inline Font(TTF_Font* font);
+
+    Font(Font const&) = delete;
+    Font& operator=(Font const&) = delete;
+
+    Font(Font&&) = default;
+    Font& operator=(Font&&) = default;
+
+    ~Font() = default;
+
+    /**
+     * @brief Get the identifier of the font
+     *
+     * Unlike the TTF_Font address, the identifier is never reused by another
+     * font, so it can key caches which outlive the font.
+     */
+    inline std::uint32_t get_id() const noexcept;
+
+    inline float get_size() const noexcept;
+
+    /**
+     * @brief Set the point size of the font
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    inline void set_size(float size);
+
+    inline FontStyle get_style() const noexcept;
+
+    /**
+     * @brief Set the style of the font
+     *
+     * @param style TTF_STYLE_NORMAL, or one or more of TTF_STYLE_BOLD,
+     *              TTF_STYLE_ITALIC, TTF_STYLE_UNDERLINE and
+     *              TTF_STYLE_STRIKETHROUGH OR'd together.
+     */
+    inline void set_style(FontStyle style) noexcept;
+
+    /**
+     * @brief Get the maximum height of the glyphs, in pixels
+     */
+    inline int get_height() const noexcept;
+
+    inline int get_ascent() const noexcept;
+
+    inline int get_descent() const noexcept;
+
+    /**
+     * @brief Get the recommended spacing between two lines, in pixels
+     */
+    inline int get_line_skip() const noexcept;
+
+    inline bool has_glyph(std::uint32_t glyph) const noexcept;
+
+    /**
+     * @brief Get the metrics of a glyph
+     *
+     * @param glyph the codepoint of the glyph.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    GlyphMetrics get_glyph_metrics(std::uint32_t glyph) const;
+
+    /**
+     * @brief Get the kerning between two glyphs, in pixels
+     *
+     * @returns the offset to add to the advance of the previous glyph, or 0
+     *          if the font has no kerning for the pair.
+     */
+    int get_kerning(std::uint32_t previous, std::uint32_t glyph) const noexcept;
+
+    /**
+     * @brief Render a glyph at high quality with alpha blending
+     *
+     * The surface is a one glyph line: it is get_height() pixels high and the
+     * glyph origin is on its left edge.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    Surface render_glyph(std::uint32_t glyph, Color const& color) const;
+
+    /**
+     * @brief Render an UTF-8 text at high quality with alpha blending
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    Surface render_text(std::string_view text, Color const& color) const;
+
+    /**
+     * @brief Get the underlying TTF_Font
+     *
+     * The ownership is kept by the Font object.
+     */
+    inline TTF_Font* get() const noexcept;
+
+private:
+    static std::uint32_t next_id() noexcept;
+
+    unique_handle<TTF_Font, &TTF_CloseFont> m_font;
+    std::uint32_t m_id;
+};
+
+// A handle and an identifier, relocated by a std::memcpy
+template <>
+struct is_trivially_relocatable<Font> : std::true_type
+{
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/Font.inl"
+#endif
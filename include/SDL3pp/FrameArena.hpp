@@ -0,0 +1,145 @@
+#ifndef SDL3PP_FRAME_ARENA_HPP
+#define SDL3PP_FRAME_ARENA_HPP
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Counters of a FrameArena
+ *
+ * The counters are accumulated until FrameArena::reset_stats() is called.
+ */
+struct FrameArenaStats
+{
+    /** Number of allocations served. */
+    std::size_t allocations = 0;
+    /** Number of blocks taken from the upstream resource because a frame outgrew its buffer. */
+    std::size_t overflow_blocks = 0;
+    /** Largest number of bytes used by a frame, alignment padding included. */
+    std::size_t peak_bytes = 0;
+    /** Number of calls to next_frame(). */
+    std::size_t frames = 0;
+};
+
+/**
+ * @brief Double-buffered bump allocator for per-frame temporaries
+ *
+ * The arena is a std::pmr::memory_resource handing out memory from one of
+ * two buffers by bumping a pointer, deallocation doing nothing. Each call
+ * to next_frame() switches to the other buffer and rewinds it, so the
+ * memory allocated during a frame stays valid until the end of the
+ * following frame: results computed in a frame can be consumed in the
+ * next one.
+ *
+ * A frame outgrowing its buffer takes more blocks from the upstream
+ * resource. When the buffer is rewound, the blocks are freed and the
+ * buffer is grown to fit the whole frame, so the steady state never
+ * reaches the upstream resource.
+ *
+ * The containers and the query functions of SDL3pp which produce
+ * temporaries, such as RenderCommandList or TextLayout::get_lines(),
+ * accept a std::pmr allocator built from the arena. The arena is not
+ * thread-safe: use one per thread.
+ *
+ * @code {.cpp}
+ * SDL3pp::FrameArena arena(1 << 20);
+ *
+ * // main loop, each frame
+ * arena.next_frame();
+ * std::pmr::vector<SDL3pp::Rect> visible(&arena);
+ * SDL3pp::RenderCommandList overlay(&arena);
+ * @endcode
+ */
+class FrameArena : public std::pmr::memory_resource
+{
+public:
+    /**
+     * @brief Construct a new FrameArena object
+     *
+     * @param capacity the initial size of each of the two buffers, in bytes.
+     * @param upstream the resource providing the buffers.
+     *
+     * @exception std::bad_alloc if the upstream resource is exhausted
+     */
+    explicit FrameArena(std::size_t capacity = 1 << 20,
+                        std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+    FrameArena(FrameArena const&) = delete;
+    FrameArena& operator=(FrameArena const&) = delete;
+
+    // The allocators keep the address of the object
+    FrameArena(FrameArena&&) = delete;
+    FrameArena& operator=(FrameArena&&) = delete;
+
+    ~FrameArena() override;
+
+    /**
+     * @brief Start a new frame
+     *
+     * The memory allocated during the frame before the current one is
+     * released: nothing allocated then may be used anymore.
+     *
+     * @exception std::bad_alloc if growing the buffer failed, the arena is
+     *            then left on the current frame
+     */
+    void next_frame();
+
+    /**
+     * @brief Get the number of bytes allocated since the start of the frame
+     */
+    inline std::size_t get_used() const noexcept;
+
+    /**
+     * @brief Get the size of the buffer of the current frame, in bytes
+     */
+    inline std::size_t get_capacity() const noexcept;
+
+    inline std::pmr::memory_resource* get_upstream() const noexcept;
+
+    FrameArenaStats get_stats() const noexcept;
+
+    void reset_stats() noexcept;
+
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+
+    bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override;
+
+private:
+    // Header of an overflow block, followed by its memory
+    struct Block
+    {
+        Block* next;
+        std::size_t size;
+    };
+
+    struct Buffer
+    {
+        std::byte* data = nullptr;
+        std::size_t capacity = 0;
+        // Free range of the buffer, or of the last overflow block
+        std::byte* cursor = nullptr;
+        std::byte* end = nullptr;
+        Block* overflow = nullptr;
+        std::size_t used = 0;
+    };
+
+    void rewind(Buffer& buffer);
+    void* allocate_overflow(Buffer& buffer, std::size_t bytes, std::size_t alignment);
+
+    std::pmr::memory_resource* m_upstream;
+    std::array<Buffer, 2> m_buffers;
+    std::size_t m_current = 0;
+    FrameArenaStats m_stats;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/FrameArena.inl"
+#endif
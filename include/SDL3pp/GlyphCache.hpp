@@ -0,0 +1,212 @@
+#ifndef SDL3PP_GLYPH_CACHE_HPP
+#define SDL3PP_GLYPH_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL3pp/Font.hpp>
+#include <SDL3pp/observer_ptr.hpp>
+#include <SDL3pp/Point.hpp>
+#include <SDL3pp/Rect.hpp>
+#include <SDL3pp/Renderer.hpp>
+#include <SDL3pp/SpriteBatch.hpp>
+#include <SDL3pp/Texture.hpp>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Counters of a GlyphCache
+ *
+ * The counters are accumulated until GlyphCache::reset_stats() is called,
+ * typically once per frame.
+ */
+struct GlyphCacheStats
+{
+    /** Number of glyph lookups served from the atlas. */
+    std::size_t hits = 0;
+    /** Number of glyphs rasterized and uploaded to the atlas. */
+    std::size_t misses = 0;
+    /** Number of atlas pages evicted to make room for new glyphs. */
+    std::size_t evicted_pages = 0;
+    /** Number of glyph quads queued by draw_text(). */
+    std::size_t glyphs_drawn = 0;
+};
+
+/**
+ * @brief Atlas of rasterized glyphs drawn as batched quads
+ *
+ * Glyphs are keyed by (font, size, codepoint, style). Each one is rendered
+ * once with SDL3_ttf, trimmed to its visible pixels and packed into square
+ * atlas textures, the pages, with a shelf allocator. draw_text() then queues
+ * one SpriteBatch quad per glyph, so a whole HUD is usually drawn with one
+ * SDL_RenderGeometry() call per page.
+ *
+ * Glyphs are rendered in white and tinted by the quad color, so the color
+ * of the text is not part of the key.
+ *
+ * When every page is full, the least recently used page is evicted as a
+ * whole. A page used since the last next_frame() is never evicted, because
+ * the quads queued in a SpriteBatch may still sample it: the cache grows
+ * past its page budget instead. Call next_frame() once per frame.
+ *
+ * @code {.cpp}
+ * SDL3pp::GlyphCache glyphs(renderer);
+ *
+ * // each frame
+ * glyphs.next_frame();
+ * glyphs.draw_text(batch, font, "Score: 42", SDL3pp::Point(10, 10));
+ * batch.flush(renderer);
+ * @endcode
+ */
+class GlyphCache
+{
+public:
+    /**
+     * @brief Location of a cached glyph
+     */
+    struct Glyph
+    {
+        /** Index of the page holding the glyph. */
+        std::size_t page = 0;
+        /** Area of the page holding the glyph, empty for blank glyphs. */
+        Rect src;
+        /** Position of the glyph relative to the pen, at the top of the line. */
+        Point offset;
+        /** Horizontal distance to the next pen position. */
+        int advance = 0;
+    };
+
+    GlyphCache() = delete;
+
+    /**
+     * @brief Construct a new GlyphCache object
+     *
+     * The pages are created on demand.
+     *
+     * @param renderer the rendering context of the pages, it must outlive the
+     *                 cache.
+     * @param page_size the width and height of the pages in pixels.
+     * @param max_pages the number of pages kept before evicting.
+     */
+    explicit GlyphCache(Renderer& renderer, int page_size = 1024, std::size_t max_pages = 4);
+
+    GlyphCache(GlyphCache const&) = delete;
+    GlyphCache& operator=(GlyphCache const&) = delete;
+
+    GlyphCache(GlyphCache&&) = default;
+    GlyphCache& operator=(GlyphCache&&) = default;
+
+    ~GlyphCache() = default;
+
+    /**
+     * @brief Find a glyph, rasterizing it on a miss
+     *
+     * The reference is valid until the next call of a non-const function.
+     *
+     * @param font the font, at its current size and style.
+     * @param glyph the codepoint of the glyph.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    Glyph const& get_glyph(Font const& font, std::uint32_t glyph);
+
+    /**
+     * @brief Queue the glyphs of an UTF-8 text into a sprite batch
+     *
+     * Kerning is applied and '\n' starts a new line.
+     *
+     * @param batch the batch to queue the quads into.
+     * @param font the font, at its current size and style.
+     * @param text the text to draw.
+     * @param position the top left corner of the first line.
+     * @param color the color of the text.
+     * @param layer the layer of the quads in the batch.
+     * @returns the pen position after the last glyph, at the top of its line.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    Point draw_text(SpriteBatch& batch, Font const& font, std::string_view text, Point const& position,
+                    Color const& color = Color{255, 255, 255, 255}, std::uint16_t layer = 0);
+
+    /**
+     * @brief Start a new frame for the LRU eviction
+     */
+    inline void next_frame() noexcept;
+
+    /**
+     * @brief Drop every cached glyph
+     *
+     * The pages are kept for reuse.
+     */
+    void clear() noexcept;
+
+    inline Texture const& get_page(std::size_t page) const noexcept;
+
+    inline std::size_t get_page_count() const noexcept;
+
+    /**
+     * @brief Get the number of cached glyphs
+     */
+    inline std::size_t get_size() const noexcept;
+
+    inline GlyphCacheStats const& get_stats() const noexcept;
+
+    inline void reset_stats() noexcept;
+
+private:
+    struct Key
+    {
+        std::uint32_t font;
+        std::uint32_t glyph;
+        float size;
+        FontStyle style;
+
+        bool operator==(Key const&) const noexcept = default;
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(Key const& key) const noexcept;
+    };
+
+    struct Shelf
+    {
+        int x;
+        int y;
+        int height;
+    };
+
+    struct Page
+    {
+        Texture texture;
+        std::vector<Shelf> shelves;
+        int bottom = 0;
+        std::vector<Key> keys;
+        std::uint64_t last_used = 0;
+    };
+
+    Glyph const& lookup(Font const& font, Key const& key);
+    Glyph rasterize(Font const& font, Key const& key);
+    std::size_t allocate(int w, int h, Point& position);
+    std::optional<Point> allocate_in(Page& page, int w, int h) const noexcept;
+    void evict(std::size_t page) noexcept;
+
+    observer_ptr<Renderer> m_renderer;
+    int m_page_size;
+    std::size_t m_max_pages;
+    std::vector<Page> m_pages;
+    std::unordered_map<Key, Glyph, KeyHash> m_glyphs;
+    std::vector<Uint32> m_scratch;
+    std::uint64_t m_frame = 1;
+    GlyphCacheStats m_stats;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/GlyphCache.inl"
+#endif
@@ -0,0 +1,191 @@
+#ifndef SDL3PP_INPUT_STATE_HPP
+#define SDL3PP_INPUT_STATE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <SDL3/SDL_keyboard.h>
+#include <SDL3/SDL_mouse.h>
+#include <SDL3/SDL_scancode.h>
+#include <SDL3pp/Point.hpp>
+
+namespace SDL3pp
+{
+
+/** Number of keys of a KeyMask, one per SDL_Scancode. */
+inline constexpr std::size_t key_count = SDL_SCANCODE_COUNT;
+
+/**
+ * @brief Set of keys, one bit per SDL_Scancode
+ *
+ * The bits are packed in 64 bit words, so that the masks of a frame are
+ * combined a whole vector register at a time.
+ */
+struct KeyMask
+{
+    /** Number of words of the mask. */
+    static constexpr std::size_t word_count = (key_count + 63) / 64;
+
+    /** Bit k % 64 of word k / 64 tells whether key k is in the set. */
+    std::array<std::uint64_t, word_count> words {};
+
+    /**
+     * @brief Check whether a key is in the set
+     *
+     * @returns false for a scancode out of range.
+     */
+    constexpr bool test(SDL_Scancode key) const noexcept;
+
+    /**
+     * @brief Check whether the set has any key
+     */
+    constexpr bool any() const noexcept;
+
+    /**
+     * @brief Count the keys of the set
+     */
+    constexpr std::size_t count() const noexcept;
+
+    friend constexpr bool operator==(KeyMask const&, KeyMask const&) noexcept = default;
+};
+
+/**
+ * @brief Snapshot of the keyboard and the mouse, with the edges since the previous frame
+ *
+ * The keyboard state is borrowed from SDL_GetKeyboardState(), which SDL
+ * keeps up to date as it pumps the events: is_key_down() reads it as it
+ * is, without copying it. update(), called once per frame after the
+ * events have been pumped, packs it into the bits of a KeyMask and
+ * derives the keys pressed, released and held since the previous update
+ * with SIMD instructions, 16 keys at a time on SSE2 and NEON. The masks
+ * are then tested as often as needed, at the cost of a bit test.
+ *
+ * The mouse position, as a Point, and the button bitmask come from
+ * SDL_GetMouseState() during the update too.
+ *
+ * @code {.cpp}
+ * SDL3pp::InputState input;
+ * // main loop
+ * while (running)
+ * {
+ *     while (SDL_PollEvent(&event)) { ... }
+ *     input.update();
+ *     if (input.is_key_pressed(SDL_SCANCODE_SPACE))
+ *         jump();
+ *     if (input.is_button_down(SDL_BUTTON_LEFT))
+ *         aim_at(input.get_mouse_position());
+ * }
+ * @endcode
+ *
+ * @see https://wiki.libsdl.org/SDL3/SDL_GetKeyboardState
+ */
+class InputState
+{
+public:
+    /**
+     * @brief Borrow the keyboard state of SDL, with no key or button down yet
+     *
+     * The mouse position is read, so that the first update has no motion.
+     *
+     * @threadsafety This function should only be called by the main thread.
+     */
+    InputState() noexcept;
+
+    InputState(InputState const&) = default;
+    InputState& operator=(InputState const&) = default;
+
+    InputState(InputState&&) = default;
+    InputState& operator=(InputState&&) = default;
+
+    ~InputState() = default;
+
+    /**
+     * @brief Take the snapshot of the frame
+     *
+     * The state of the previous call becomes the previous frame, from
+     * which the pressed, released and held masks are computed.
+     *
+     * @threadsafety This function should only be called by the main thread.
+     */
+    void update() noexcept;
+
+    /**
+     * @brief Check whether a key is down right now, in the borrowed state of SDL
+     */
+    inline bool is_key_down(SDL_Scancode key) const noexcept;
+
+    /**
+     * @brief Check whether a key went down between the last two updates
+     */
+    inline bool is_key_pressed(SDL_Scancode key) const noexcept;
+
+    /**
+     * @brief Check whether a key went up between the last two updates
+     */
+    inline bool is_key_released(SDL_Scancode key) const noexcept;
+
+    /**
+     * @brief Check whether a key was down at both of the last two updates
+     */
+    inline bool is_key_held(SDL_Scancode key) const noexcept;
+
+    /** Keys down at the last update. */
+    inline KeyMask const& get_keys() const noexcept;
+
+    /** Keys which went down between the last two updates. */
+    inline KeyMask const& get_pressed_keys() const noexcept;
+
+    /** Keys which went up between the last two updates. */
+    inline KeyMask const& get_released_keys() const noexcept;
+
+    /** Keys down at both of the last two updates. */
+    inline KeyMask const& get_held_keys() const noexcept;
+
+    /**
+     * @brief Get the position of the mouse in the focused window at the last update
+     */
+    inline Point get_mouse_position() const noexcept;
+
+    /**
+     * @brief Get the motion of the mouse between the last two updates
+     */
+    inline Point get_mouse_motion() const noexcept;
+
+    /**
+     * @brief Get the buttons down at the last update, as SDL_BUTTON_MASK() bits
+     */
+    inline SDL_MouseButtonFlags get_mouse_buttons() const noexcept;
+
+    /**
+     * @brief Check whether a button, such as SDL_BUTTON_LEFT, was down at the last update
+     */
+    inline bool is_button_down(Uint8 button) const noexcept;
+
+    /**
+     * @brief Check whether a button went down between the last two updates
+     */
+    inline bool is_button_pressed(Uint8 button) const noexcept;
+
+    /**
+     * @brief Check whether a button went up between the last two updates
+     */
+    inline bool is_button_released(Uint8 button) const noexcept;
+
+private:
+    std::span<const bool> m_keyboard;
+    KeyMask m_keys;
+    KeyMask m_pressed;
+    KeyMask m_released;
+    KeyMask m_held;
+    Point m_mouse_position;
+    Point m_mouse_motion;
+    SDL_MouseButtonFlags m_buttons;
+    SDL_MouseButtonFlags m_previous_buttons;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/InputState.inl"
+#endif
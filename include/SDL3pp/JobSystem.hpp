@@ -0,0 +1,267 @@
+#ifndef SDL3PP_JOB_SYSTEM_HPP
+#define SDL3PP_JOB_SYSTEM_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <SDL3pp/WorkStealingDeque.hpp>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Settings of a JobSystem
+ */
+struct JobSystemConfig
+{
+    /** Number of worker threads, 0 for one less than the logical CPU cores, at least 1. */
+    std::size_t worker_count = 0;
+    /** Called first by each worker thread with its index, e.g. to set its affinity or name. */
+    std::function<void(std::size_t)> on_worker_start;
+};
+
+/**
+ * @brief Counters of a JobSystem
+ */
+struct JobSystemStats
+{
+    /** Number of jobs run, by the workers or by threads waiting on a counter. */
+    std::size_t executed_jobs = 0;
+    /** Number of jobs taken from the deque of another worker. */
+    std::size_t stolen_jobs = 0;
+    /** Number of jobs run at once by a worker because its deque was full. */
+    std::size_t inline_jobs = 0;
+};
+
+/**
+ * @brief Thread pool balancing jobs by work stealing
+ *
+ * Each worker owns a Chase–Lev WorkStealingDeque: it pushes the jobs it
+ * submits and pops them back in LIFO order, while idle workers steal the
+ * oldest jobs of the others. Jobs submitted from other threads go through
+ * a shared injection queue. Idle workers sleep on an atomic counter bumped
+ * by each submission, and only sleeping workers cost a wake-up.
+ *
+ * Completion is tracked by a Counter: submit() increments it and the end
+ * of the job decrements it. wait() runs pending jobs until the counter
+ * drops to zero, so a job may wait on the jobs it spawned without
+ * starving the pool. submit_after() defers a job until a counter is done,
+ * which chains dependent stages without blocking any thread.
+ *
+ * The library submits its own background work, such as the decoding of
+ * MusicStream, to the shared instance returned by get_instance(). Its
+ * worker count can be pinned with configure() before the first use.
+ *
+ * Jobs must not throw.
+ *
+ * @code {.cpp}
+ * SDL3pp::JobSystem& jobs = SDL3pp::JobSystem::get_instance();
+ * jobs.parallel_for(0, particles.size(), 4096, [&](std::size_t begin, std::size_t end) {
+ *     for (std::size_t i = begin; i < end; ++i)
+ *         particles[i].update(delta);
+ * });
+ * @endcode
+ */
+class JobSystem
+{
+    struct Job;
+
+public:
+    /**
+     * @brief Number of unfinished jobs, to wait for or to depend on
+     *
+     * A counter must outlive the jobs it counts. It can be reused once
+     * done.
+     */
+    class Counter
+    {
+    public:
+        Counter() = default;
+
+        Counter(Counter const&) = delete;
+        Counter& operator=(Counter const&) = delete;
+
+        Counter(Counter&&) = delete;
+        Counter& operator=(Counter&&) = delete;
+
+        ~Counter() = default;
+
+        inline bool is_done() const noexcept;
+
+        inline std::size_t get_pending() const noexcept;
+
+    private:
+        friend class JobSystem;
+
+        // Twice the number of unfinished jobs, 1 while the last one releases
+        // the continuations
+        std::atomic<std::size_t> m_pending {0};
+        // Jobs submitted by submit_after(), linked through Job::next
+        std::atomic<Job*> m_continuations {nullptr};
+    };
+
+    /**
+     * @brief Construct a new JobSystem object and start its workers
+     *
+     * @param config the settings of the pool.
+     */
+    explicit JobSystem(JobSystemConfig config = {});
+
+    JobSystem(JobSystem const&) = delete;
+    JobSystem& operator=(JobSystem const&) = delete;
+
+    // The workers keep the address of the object
+    JobSystem(JobSystem&&) = delete;
+    JobSystem& operator=(JobSystem&&) = delete;
+
+    /**
+     * @brief Stop the workers and destroy the pool
+     *
+     * The jobs which have not started are dropped: wait for their counters
+     * first.
+     */
+    ~JobSystem();
+
+    /**
+     * @brief Pin the settings of the shared instance
+     *
+     * @param config the settings used by get_instance().
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     *
+     * @threadsafety It is safe to call this function from any thread, but
+     *               only before the first call of get_instance().
+     */
+    static void configure(JobSystemConfig config);
+
+    /**
+     * @brief Get the pool shared by the library, starting it at the first call
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    static JobSystem& get_instance();
+
+    /**
+     * @brief Run a job on a worker
+     *
+     * @param job the job.
+     * @param counter the counter of the job, may be null.
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    void submit(std::function<void()> job, Counter* counter = nullptr);
+
+    /**
+     * @brief Run a job once a counter is done
+     *
+     * The jobs counted by dependency must have been submitted already.
+     *
+     * @param dependency the counter to wait for.
+     * @param job the job.
+     * @param counter the counter of the job, may be null. It is incremented
+     *                at once.
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    void submit_after(Counter& dependency, std::function<void()> job, Counter* counter = nullptr);
+
+    /**
+     * @brief Run pending jobs until a counter is done
+     *
+     * @param counter the counter to wait for.
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    void wait(Counter& counter) noexcept;
+
+    /**
+     * @brief Call a function over a range of indices split into chunks
+     *
+     * The calling thread runs the first chunk and helps with the others,
+     * then returns when every chunk is done.
+     *
+     * @param begin the first index.
+     * @param end the index after the last one.
+     * @param grain the number of indices per chunk, 0 to make about 4 chunks
+     *              per thread.
+     * @param function the function called as function(chunk_begin, chunk_end).
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    template <typename F>
+    void parallel_for(std::size_t begin, std::size_t end, std::size_t grain, F&& function);
+
+    inline std::size_t get_worker_count() const noexcept;
+
+    /**
+     * @brief Check whether the calling thread is a worker of this pool
+     */
+    bool is_worker_thread() const noexcept;
+
+    JobSystemStats get_stats() const noexcept;
+
+private:
+    using RangeFunction = void (*)(void* context, std::size_t begin, std::size_t end);
+
+    struct Job
+    {
+        std::function<void()> function;
+        // Set instead of function by parallel_for(), which avoids wrapping
+        // every chunk in a std::function
+        RangeFunction range_function = nullptr;
+        void* context = nullptr;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+        Counter* counter = nullptr;
+        // Next continuation of a counter, or next job of the injection queue
+        Job* next = nullptr;
+    };
+
+    // Separate the workers to avoid false sharing of their counters
+    static constexpr std::size_t cache_line_size = 64;
+
+    struct alignas(cache_line_size) Worker
+    {
+        explicit Worker(std::size_t capacity) : deque(capacity) {}
+
+        WorkStealingDeque<Job*> deque;
+        std::atomic<std::size_t> executed_jobs {0};
+        std::atomic<std::size_t> stolen_jobs {0};
+        std::atomic<std::size_t> inline_jobs {0};
+        std::thread thread;
+    };
+
+    void submit_range(RangeFunction function, void* context, std::size_t begin, std::size_t end, Counter& counter);
+    void push(Job* job) noexcept;
+    Job* find_job(std::size_t index) noexcept;
+    void execute(Job* job) noexcept;
+    void finish(Counter* counter) noexcept;
+    void release_continuations(Counter& counter) noexcept;
+    void run(std::size_t index) noexcept;
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::function<void(std::size_t)> m_on_worker_start;
+
+    // Jobs submitted by the other threads, linked through Job::next so that
+    // finish() can push the released continuations without allocating
+    std::mutex m_injected_mutex;
+    Job* m_injected_head = nullptr;
+    Job* m_injected_tail = nullptr;
+    std::atomic<std::size_t> m_injected_count {0};
+    std::atomic<std::size_t> m_external_executed_jobs {0};
+
+    std::atomic<bool> m_stop {false};
+    std::atomic<std::uint32_t> m_signal {0};
+    std::atomic<std::size_t> m_sleeping {0};
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/JobSystem.inl"
+#endif
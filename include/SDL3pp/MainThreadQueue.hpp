@@ -0,0 +1,193 @@
+#ifndef SDL3PP_MAIN_THREAD_QUEUE_HPP
+#define SDL3PP_MAIN_THREAD_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <type_traits>
+
+#include <SDL3/SDL_init.h>
+#include <SDL3pp/SmallFunction.hpp>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Counters of a MainThreadQueue
+ */
+struct MainThreadQueueStats
+{
+    /** Number of tasks queued. */
+    std::size_t posted_tasks = 0;
+    /** Number of tasks run by the main thread. */
+    std::size_t executed_tasks = 0;
+    /** Number of posts which found the queue full and had to wait for room. */
+    std::size_t full_waits = 0;
+};
+
+/**
+ * @brief Lock-free queue of tasks to run on the main thread
+ *
+ * Many SDL functions, such as the window and event functions, must be
+ * called from the main thread. Any thread can post tasks to the queue, and
+ * the main loop runs them with drain(), usually once per frame.
+ *
+ * The queue is a bounded ring of slots, each with a sequence number:
+ * producers claim a slot with one compare-and-swap on the tail and publish
+ * it through its sequence, and the main thread consumes the published
+ * slots in order without any atomic read-modify-write. The tasks are
+ * SmallFunction objects stored in the slots, so posting a lambda with a
+ * few captures allocates nothing. A producer finding the queue full sleeps
+ * until the next drain(); the main thread itself runs its task at once
+ * instead.
+ *
+ * With SDL dispatch enabled, a post also asks SDL_RunOnMainThread() to
+ * drain the queue, so the tasks run from the event pump even if the main
+ * loop is blocked in SDL_WaitEvent(). The requests are coalesced: at most
+ * one is pending at a time.
+ *
+ * @code {.cpp}
+ * SDL3pp::MainThreadQueue queue;
+ *
+ * // worker thread
+ * queue.post([&window, title] { window.set_title(title); });
+ * std::future<bool> shown = queue.invoke([&window] { return window.is_shown(); });
+ *
+ * // main loop, each frame
+ * queue.drain();
+ * @endcode
+ *
+ * @see https://wiki.libsdl.org/SDL3/SDL_RunOnMainThread
+ */
+class MainThreadQueue
+{
+public:
+    using Task = SmallFunction<void(), 64>;
+
+    /**
+     * @brief Construct a new MainThreadQueue object
+     *
+     * @param capacity the minimum number of tasks the queue can hold.
+     */
+    explicit MainThreadQueue(std::size_t capacity = 1024);
+
+    MainThreadQueue(MainThreadQueue const&) = delete;
+    MainThreadQueue& operator=(MainThreadQueue const&) = delete;
+
+    // Producers and SDL dispatch keep the address of the object
+    MainThreadQueue(MainThreadQueue&&) = delete;
+    MainThreadQueue& operator=(MainThreadQueue&&) = delete;
+
+    /**
+     * @brief Destroy the queue, dropping the tasks which did not run
+     *
+     * A pending SDL dispatch keeps the address of the queue: destroy it
+     * after SDL_Quit(), or once is_dispatch_pending() is false.
+     */
+    ~MainThreadQueue();
+
+    /**
+     * @brief Queue a task, fire and forget
+     *
+     * @param task the task, which must not throw.
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    template <typename F>
+    void post(F&& task);
+
+    /**
+     * @brief Queue a task if there is room
+     *
+     * @param task the task, which must not throw.
+     * @returns false if the queue is full, task being left untouched.
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    template <typename F>
+    bool try_post(F&& task);
+
+    /**
+     * @brief Run a task on the main thread and get its result
+     *
+     * Called from the main thread, the task runs at once, so waiting on the
+     * future can not deadlock. An exception thrown by the task is stored in
+     * the future.
+     *
+     * @param task the task.
+     * @returns the future result of the task.
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    template <typename F>
+    std::future<std::invoke_result_t<std::decay_t<F>&>> invoke(F&& task);
+
+    /**
+     * @brief Run the tasks queued so far
+     *
+     * The tasks posted while draining run at the next call.
+     *
+     * @returns the number of tasks run.
+     *
+     * @threadsafety This function should only be called by the main thread.
+     */
+    std::size_t drain() noexcept;
+
+    /**
+     * @brief Enable or disable the draining of the queue by SDL_RunOnMainThread()
+     *
+     * @param enabled true to ask SDL to drain the queue after each post.
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    void set_sdl_dispatch(bool enabled) noexcept;
+
+    inline bool is_dispatch_pending() const noexcept;
+
+    /**
+     * @brief Get an estimate of the number of tasks waiting
+     */
+    inline std::size_t get_size() const noexcept;
+
+    inline std::size_t get_capacity() const noexcept;
+
+    /**
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    MainThreadQueueStats get_stats() const noexcept;
+
+private:
+    struct Slot
+    {
+        std::atomic<std::size_t> sequence;
+        Task task;
+    };
+
+    void push(Task&& task);
+    bool try_push(Task& task) noexcept;
+    void request_dispatch() noexcept;
+    static void SDLCALL on_dispatch(void* userdata);
+
+    // Separate the producer and consumer indices to avoid false sharing
+    static constexpr std::size_t cache_line_size = 64;
+
+    std::unique_ptr<Slot[]> m_slots;
+    std::size_t m_mask;
+
+    alignas(cache_line_size) std::atomic<std::size_t> m_tail {0};
+    std::atomic<std::size_t> m_posted_tasks {0};
+    std::atomic<std::size_t> m_full_waits {0};
+    std::atomic<std::size_t> m_waiting_producers {0};
+
+    alignas(cache_line_size) std::atomic<std::size_t> m_head {0};
+    std::atomic<std::size_t> m_executed_tasks {0};
+
+    std::atomic<bool> m_sdl_dispatch {false};
+    std::atomic<bool> m_dispatch_pending {false};
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/MainThreadQueue.inl"
+#endif
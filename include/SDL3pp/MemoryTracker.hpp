@@ -0,0 +1,197 @@
+#ifndef SDL3PP_MEMORY_TRACKER_HPP
+#define SDL3PP_MEMORY_TRACKER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Subsystem charged with an allocation
+ */
+enum class MemoryTag : std::uint8_t
+{
+    general,
+    video,
+    render,
+    surface,
+    audio,
+    text,
+    io,
+    count
+};
+
+inline constexpr std::size_t memory_tag_count = static_cast<std::size_t>(MemoryTag::count);
+
+/**
+ * @brief Get the name of a MemoryTag, for reports
+ */
+inline constexpr const char* get_memory_tag_name(MemoryTag tag) noexcept;
+
+/**
+ * @brief Memory counters of a MemoryTag, or of every tag
+ */
+struct MemoryTagStats
+{
+    /** Number of allocations, a reallocation counting as one. */
+    std::size_t allocations = 0;
+    /** Number of frees, a reallocation counting as one. */
+    std::size_t frees = 0;
+    /** Number of bytes currently allocated. */
+    std::size_t live_bytes = 0;
+    /**
+     * Largest value of live_bytes since the installation or reset_peaks():
+     * exact for the total, sampled by get_stats() and next_frame() for a tag.
+     */
+    std::size_t peak_bytes = 0;
+};
+
+/**
+ * @brief Snapshot of the counters of the MemoryTracker
+ */
+struct MemoryStats
+{
+    /** Counters per tag, indexed by MemoryTag. */
+    std::array<MemoryTagStats, memory_tag_count> tags;
+    /** Counters of every tag together. */
+    MemoryTagStats total;
+    /** Number of allocations during the last frame completed by next_frame(). */
+    std::size_t frame_allocations = 0;
+    /** Allocations per second during the last frame completed by next_frame(). */
+    double allocation_rate = 0.;
+};
+
+/**
+ * @brief Opt-in accounting of the memory allocated by SDL
+ *
+ * install() routes SDL_malloc(), SDL_calloc(), SDL_realloc() and SDL_free()
+ * through a tracked allocator, which prefixes each block with its size and
+ * with the MemoryTag of the MemoryScope active on the allocating thread.
+ * The library opens scopes around the calls allocating SDL objects, such
+ * as the creation of windows, renderers, surfaces or audio streams, and an
+ * application can open its own.
+ *
+ * The counts and sizes of the allocations and frees go to counters owned
+ * by the calling thread, which get_stats() sums; only the total of the
+ * live bytes, followed for its peak, is shared between the threads. The
+ * memory resource returned by get_resource() is tracked the same way, to
+ * account for the containers of the application next to SDL.
+ *
+ * next_frame() closes the frame: the number of allocations of the frame
+ * and their rate are kept in the stats, and get_frame_allocations() counts
+ * the allocations of the frame in progress, which steady-state tests can
+ * expect to be 0.
+ *
+ * @code {.cpp}
+ * int main()
+ * {
+ *     SDL3pp::MemoryTracker::install(); // before any other SDL call
+ *     ...
+ *     // main loop, each frame
+ *     SDL3pp::MemoryTracker::next_frame();
+ *     std::size_t live = SDL3pp::MemoryTracker::get_stats().total.live_bytes;
+ * }
+ * @endcode
+ *
+ * @see https://wiki.libsdl.org/SDL3/SDL_SetMemoryFunctions
+ */
+class MemoryTracker
+{
+public:
+    MemoryTracker() = delete;
+
+    /**
+     * @brief Route the allocations of SDL through the tracked allocator
+     *
+     * It must be called before any other SDL function, as the blocks
+     * allocated before could not be freed by the tracked allocator. It
+     * can not be undone; calling it again does nothing.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     *
+     * @threadsafety This function is not thread safe.
+     */
+    static void install();
+
+    static bool is_installed() noexcept;
+
+    /**
+     * @brief Get a memory resource accounted like the allocations of SDL
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    static std::pmr::memory_resource* get_resource() noexcept;
+
+    /**
+     * @brief Sum the counters of every thread
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    static MemoryStats get_stats() noexcept;
+
+    /**
+     * @brief Get the number of allocations since the last call to next_frame()
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    static std::size_t get_frame_allocations() noexcept;
+
+    /**
+     * @brief End the current frame and start the next one
+     *
+     * @threadsafety This function should only be called by the main thread.
+     */
+    static void next_frame() noexcept;
+
+    /**
+     * @brief Restart the peaks from the current live bytes
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    static void reset_peaks() noexcept;
+};
+
+/**
+ * @brief Scope charging the allocations of the calling thread to a MemoryTag
+ *
+ * Scopes nest: the previous tag is restored by the destructor. Opening a
+ * scope is a thread-local store, whether the tracker is installed or not.
+ *
+ * @code {.cpp}
+ * {
+ *     SDL3pp::MemoryScope scope(SDL3pp::MemoryTag::audio);
+ *     load_sound_bank();
+ * }
+ * @endcode
+ */
+class MemoryScope
+{
+public:
+    MemoryScope() = delete;
+
+    explicit MemoryScope(MemoryTag tag) noexcept;
+
+    MemoryScope(MemoryScope const&) = delete;
+    MemoryScope& operator=(MemoryScope const&) = delete;
+
+    MemoryScope(MemoryScope&&) = delete;
+    MemoryScope& operator=(MemoryScope&&) = delete;
+
+    ~MemoryScope();
+
+    /**
+     * @brief Get the tag of the innermost scope of the calling thread
+     */
+    static MemoryTag get_current() noexcept;
+
+private:
+    MemoryTag m_previous;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/MemoryTracker.inl"
+#endif
@@ -0,0 +1,165 @@
+#ifndef SDL3PP_MUSIC_STREAM_HPP
+#define SDL3PP_MUSIC_STREAM_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include <SDL3pp/AudioDecoder.hpp>
+#include <SDL3pp/AudioStream.hpp>
+#include <SDL3pp/JobSystem.hpp>
+#include <SDL3pp/SpscRing.hpp>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Counters of a MusicStream
+ */
+struct MusicStreamStats
+{
+    /** Number of frames decoded by the decoding jobs. */
+    std::size_t decoded_frames = 0;
+    /** Number of frames taken by the consumer. */
+    std::size_t read_frames = 0;
+    /** Number of reads which found fewer frames than requested, from the first chunk to the end. */
+    std::size_t underruns = 0;
+    /** Time from the construction to the first decoded chunk, 0 until then. */
+    std::chrono::nanoseconds time_to_first_sample {0};
+    /** Memory used by the ring and the chunk buffers, constant for the stream. */
+    std::size_t resident_bytes = 0;
+};
+
+/**
+ * @brief Music track decoded in the background
+ *
+ * Jobs of a JobSystem decode the track chunk by chunk into an SpscRing,
+ * keeping it as full as possible ahead of the playhead. The consumer,
+ * usually the game thread feeding an AudioStream, takes the frames as soon
+ * as the first chunk is decoded, long before the track is. The memory of
+ * the stream is the ring and two chunk buffers, whatever the length of the
+ * track.
+ *
+ * At most one decoding job runs at a time. It returns to the pool as soon
+ * as the ring is full, instead of blocking a worker, and the consumer
+ * submits the next one once a read frees room for a chunk.
+ *
+ * @code {.cpp}
+ * SDL3pp::MusicStream music(std::make_unique<SDL3pp::WavDecoder>("theme.wav"));
+ * SDL3pp::AudioStream stream(music.get_channels(), music.get_frequency(), 8192);
+ * stream.resume();
+ *
+ * // game thread, each frame
+ * music.feed(stream);
+ * @endcode
+ */
+class MusicStream
+{
+public:
+    MusicStream() = delete;
+
+    /**
+     * @brief Construct a new MusicStream object and start decoding
+     *
+     * @param decoder the decoder of the track.
+     * @param prefetch_frames the number of frames decoded ahead of the
+     *                        consumer at most.
+     * @param chunk_frames the number of frames decoded at once.
+     * @param loop true to restart the track at its end.
+     * @param jobs the pool running the decoding jobs.
+     */
+    explicit MusicStream(std::unique_ptr<AudioDecoder> decoder, std::size_t prefetch_frames = 65536,
+                         std::size_t chunk_frames = 4096, bool loop = false,
+                         JobSystem& jobs = JobSystem::get_instance());
+
+    MusicStream(MusicStream const&) = delete;
+    MusicStream& operator=(MusicStream const&) = delete;
+
+    // The decoding jobs keep the address of the object
+    MusicStream(MusicStream&&) = delete;
+    MusicStream& operator=(MusicStream&&) = delete;
+
+    /**
+     * @brief Wait for the decoding job and destroy the stream
+     */
+    ~MusicStream();
+
+    /**
+     * @brief Take decoded frames
+     *
+     * @param samples the interleaved samples to fill, the number of samples
+     *                is rounded down to whole frames.
+     * @returns the number of frames read.
+     *
+     * @threadsafety This function should only be called by the consumer.
+     */
+    std::size_t read(std::span<float> samples) noexcept;
+
+    /**
+     * @brief Move decoded frames to an audio stream until its ring is full
+     *
+     * @param stream a stream with as many channels as the track.
+     * @returns the number of frames moved.
+     *
+     * @threadsafety This function should only be called by the consumer.
+     */
+    std::size_t feed(AudioStream& stream) noexcept;
+
+    /**
+     * @brief Check whether the first chunk has been decoded
+     */
+    inline bool is_ready() const noexcept;
+
+    /**
+     * @brief Check whether the whole track has been read
+     */
+    inline bool is_finished() const noexcept;
+
+    inline int get_channels() const noexcept;
+
+    inline int get_frequency() const noexcept;
+
+    /**
+     * @brief Get the number of decoded frames waiting for the consumer
+     */
+    inline std::size_t get_buffered_frames() const noexcept;
+
+    /**
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    MusicStreamStats get_stats() const noexcept;
+
+private:
+    void schedule_decode() noexcept;
+    void decode() noexcept;
+
+    std::unique_ptr<AudioDecoder> m_decoder;
+    int m_channels;
+    int m_frequency;
+    std::size_t m_chunk_frames;
+    bool m_loop;
+    SpscRing<float> m_ring;
+    std::unique_ptr<float[]> m_decode_chunk;
+    std::unique_ptr<float[]> m_feed_chunk;
+    std::chrono::steady_clock::time_point m_start;
+    JobSystem& m_jobs;
+    JobSystem::Counter m_decoding_job;
+    // Only touched by the decoding job
+    bool m_rewound = false;
+
+    std::atomic<bool> m_stop {false};
+    std::atomic<bool> m_end {false};
+    std::atomic<bool> m_decoding {false};
+    std::atomic<std::size_t> m_decoded_frames {0};
+    std::atomic<std::size_t> m_read_frames {0};
+    std::atomic<std::size_t> m_underruns {0};
+    std::atomic<std::int64_t> m_time_to_first_sample {0};
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/MusicStream.inl"
+#endif
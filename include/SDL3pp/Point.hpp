@@ -3,7 +3,8 @@
 #define SDL3PP_POINT_HH
 
 #include <functional>
-#include <iostream>
+#include <iosfwd>
+#include <utility>
 
 #include <SDL3/SDL_rect.h>
 
@@ -232,7 +233,7 @@ public:
    *  @returns Clamped point
    *
    */
-  Point get_clamped(const Rect& rect) const;
+  constexpr Point get_clamped(const Rect& rect) const;
 
   /**
    * @brief Clamp point coordinates to make it fit into a
@@ -243,7 +244,7 @@ public:
    *  @returns Reference to self
    *
    */
-  Point& clamp(const Rect& rect);
+  constexpr Point& clamp(const Rect& rect);
 
   /**
    * @brief Get a point wrapped within a specified rect
@@ -253,7 +254,7 @@ public:
    *  @returns Wrapped point
    *
    */
-  Point get_wrapped(const Rect& rect) const;
+  constexpr Point get_wrapped(const Rect& rect) const;
 
   /**
    * @brief Wrap point coordinates within a spedified rect
@@ -263,7 +264,7 @@ public:
    *  @returns Reference to self
    *
    */
-  Point& wrap(const Rect& rect);
+  constexpr Point& wrap(const Rect& rect);
 };
 
 }
@@ -393,14 +394,18 @@ operator!=(SDL3pp::Point const& a, SDL3pp::Point const& b) noexcept;
 /**
  * @brief Stream output operator overload for SDL3pp::Point
  *
+ *  A template on the stream, so that only <iosfwd> is needed here: the
+ *  code printing a point includes <ostream> anyway.
+ *
  *  @param[in] stream Stream to output to
  *  @param[in] point Point to output
  *
  *  @returns stream
  *
  */
-SDL3PP_EXPORT std::ostream&
-operator<<(std::ostream& stream, SDL3pp::Point const& point);
+template<class CharT, class Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& stream, SDL3pp::Point const& point);
 
 /**
  * @brief std::hash specialization for SDL3pp::Rect
@@ -427,4 +432,6 @@ struct std::hash<SDL3pp::Point>
 };
 
 #include "inline_src/Point.inl"
+// Defines the members of Point taking a Rect
+#include <SDL3pp/Rect.hpp>
 #endif
@@ -0,0 +1,155 @@
+#ifndef SDL3PP_PROFILER_HPP
+#define SDL3PP_PROFILER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3pp/Config.hpp>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Zone recorded by a thread
+ */
+struct ProfileEvent
+{
+    /** Name given to SDL3PP_ZONE(), a string with static storage duration. */
+    const char* name;
+    /** Value of SDL_GetPerformanceCounter() when the zone was entered. */
+    Uint64 start;
+    /** Value of SDL_GetPerformanceCounter() when the zone was left. */
+    Uint64 end;
+    /** Identifier of the recording thread, in the order of their first zone. */
+    std::uint32_t thread;
+};
+
+/**
+ * @brief Collector of the zones recorded by SDL3PP_ZONE()
+ *
+ * Each thread records its zones into its own wait-free ring, registered
+ * the first time it leaves a zone; a full ring drops the zones until the
+ * next collect(). collect() and write_chrome_trace() drain the rings of
+ * every thread, including the threads which have exited since. The time
+ * zero of the traces is the start of the earliest recorded zone: nothing
+ * is measured before.
+ *
+ * The zones are only compiled in when SDL3PP_WITH_PROFILER is defined, by
+ * the CMake option of the same name: otherwise SDL3PP_ZONE() expands to
+ * nothing, and the collector always comes back empty. The library marks
+ * its own hot paths, such as the renderer flushes, the blits, the glyph
+ * rasterization, the jobs and the audio mixing.
+ *
+ * @code {.cpp}
+ * void update_world()
+ * {
+ *     SDL3PP_ZONE("update_world");
+ *     ...
+ * }
+ *
+ * // at exit, open the file in chrome://tracing or https://ui.perfetto.dev
+ * SDL3pp::Profiler::write_chrome_trace("trace.json");
+ * @endcode
+ */
+class Profiler
+{
+public:
+    Profiler() = delete;
+
+    /** Number of zones each thread can record between two collections. */
+    static constexpr std::size_t ring_capacity = 1 << 14;
+
+    /**
+     * @brief Remove the zones recorded by every thread since the last collection
+     *
+     * @returns the zones, sorted by thread then by end.
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    static std::vector<ProfileEvent> collect();
+
+    /**
+     * @brief Collect the zones and write them as a Chrome trace event file
+     *
+     * The JSON file can be opened by chrome://tracing and by Perfetto.
+     *
+     * @param file the path of the file to write.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    static void write_chrome_trace(std::string const& file);
+
+    /**
+     * @brief Format zones as a Chrome trace event JSON document
+     */
+    static std::string to_chrome_trace(std::vector<ProfileEvent> const& events);
+
+    /**
+     * @brief Name the calling thread in the traces
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    static void set_thread_name(std::string name);
+
+    /**
+     * @brief Get the number of zones dropped because a ring was full
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    static std::size_t get_dropped_events() noexcept;
+
+    /**
+     * @brief Record a zone of the calling thread
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    static void record(const char* name, Uint64 start, Uint64 end) noexcept;
+};
+
+/**
+ * @brief Scope recorded as a zone of the Profiler, used by SDL3PP_ZONE()
+ */
+class ProfileZone
+{
+public:
+    ProfileZone() = delete;
+
+    inline explicit ProfileZone(const char* name) noexcept;
+
+    ProfileZone(ProfileZone const&) = delete;
+    ProfileZone& operator=(ProfileZone const&) = delete;
+
+    ProfileZone(ProfileZone&&) = delete;
+    ProfileZone& operator=(ProfileZone&&) = delete;
+
+    inline ~ProfileZone();
+
+private:
+    const char* m_name;
+    Uint64 m_start;
+};
+
+} // namespace SDL3pp
+
+#define SDL3PP_ZONE_CONCAT_(a, b) a##b
+#define SDL3PP_ZONE_CONCAT(a, b) SDL3PP_ZONE_CONCAT_(a, b)
+
+/**
+ * @brief Record the rest of the enclosing scope as a zone named name
+ *
+ * name must be a string literal. Without SDL3PP_WITH_PROFILER, it expands
+ * to nothing.
+ */
+#ifdef SDL3PP_WITH_PROFILER
+#define SDL3PP_ZONE(name) const ::SDL3pp::ProfileZone SDL3PP_ZONE_CONCAT(sdl3pp_zone_, __LINE__)(name)
+#else
+#define SDL3PP_ZONE(name) static_cast<void>(0)
+#endif
+
+#include "inline_src/Profiler.inl"
+#endif
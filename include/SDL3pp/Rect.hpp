@@ -24,6 +24,7 @@
 
 #include <SDL3/SDL_rect.h>
 #include <functional>
+#include <iosfwd>
 #include <optional>
 #include <utility>
 
@@ -374,7 +375,7 @@ public:
    *  @returns Rect representing union of two rectangles
    *
    */
-  Rect get_union(Rect const& rect) const;
+  constexpr Rect get_union(Rect const& rect) const;
 
   /**
    *  @brief Union rect with another rect
@@ -384,7 +385,7 @@ public:
    *  @returns Reference to self
    *
    */
-  Rect& union_in_place(const Rect& rect);
+  constexpr Rect& union_in_place(const Rect& rect);
 
   /**
    *  @brief Get a rect extended by specified amount of pixels
@@ -394,7 +395,7 @@ public:
    *  @returns Extended rect
    *
    */
-  Rect get_extension(unsigned int amount) const;
+  constexpr Rect get_extension(unsigned int amount) const;
 
   /**
    *  @brief Get a rect extended by specified amount of pixels
@@ -407,7 +408,7 @@ public:
    *  @returns Extended rect
    *
    */
-  Rect get_extension(unsigned int hamount, unsigned int vamount) const;
+  constexpr Rect get_extension(unsigned int hamount, unsigned int vamount) const;
 
   /**
    *  @brief Extend a rect by specified amount of pixels
@@ -417,7 +418,7 @@ public:
    *  @returns Reference to self
    *
    */
-  Rect& extend_in_place(unsigned int amount);
+  constexpr Rect& extend_in_place(unsigned int amount);
 
   /**
    *  @brief Extend a rect by specified amount of pixels
@@ -430,7 +431,7 @@ public:
    *  @returns Reference to self
    *Extend
    */
-  Rect& extend_in_place(unsigned int hamount, unsigned int vamount);
+  constexpr Rect& extend_in_place(unsigned int hamount, unsigned int vamount);
 
   /**
    *  @brief Calculate intersection with another rect
@@ -441,7 +442,7 @@ public:
    * intersection
    *
    */
-  std::optional<Rect> get_intersection(const Rect& rect) const;
+  constexpr std::optional<Rect> get_intersection(const Rect& rect) const;
 
   /**
    *  @brief Calculate the intersection of a rectangle and line segment
@@ -462,7 +463,7 @@ public:
    *  necessary.
    *
    */
-  bool intersect_line(int& x1, int& y1, int& x2, int& y2) const;
+  inline bool intersect_line(int& x1, int& y1, int& x2, int& y2) const;
 
   /**
    *  @brief Calculate the intersection of a rectangle and line segment
@@ -480,7 +481,7 @@ public:
    *  the new coordinates saved in p1 and/or p2 as necessary.
    *
    */
-  bool intersect_line(Point& p1, Point& p2) const;
+  inline bool intersect_line(Point& p1, Point& p2) const;
 
   /**
    *  @brief Get rectangle moved by a given offset
@@ -516,7 +517,7 @@ public:
    *  @returns Reference to self
    *
    */
-  Rect& operator+=(const Point& offset)
+  constexpr Rect& operator+=(const Point& offset)
   {
     x += offset.get_x();
     y += offset.get_y();
@@ -531,7 +532,7 @@ public:
    *  @returns Reference to self
    *
    */
-  Rect& operator-=(const Point& offset)
+  constexpr Rect& operator-=(const Point& offset)
   {
     x -= offset.get_x();
     y -= offset.get_y();
@@ -581,8 +582,9 @@ operator!=(const SDL3pp::Rect& a, const SDL3pp::Rect& b)
  *  @returns stream
  *
  */
-SDL3PP_EXPORT std::ostream&
-operator<<(std::ostream& stream, const SDL3pp::Rect& rect);
+template<class CharT, class Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& stream, const SDL3pp::Rect& rect);
 
 namespace std {
 
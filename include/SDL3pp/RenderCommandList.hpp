@@ -0,0 +1,200 @@
+#ifndef SDL3PP_RENDER_COMMAND_LIST_HPP
+#define SDL3PP_RENDER_COMMAND_LIST_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <SDL3/SDL_pixels.h>
+#include <SDL3/SDL_render.h>
+#include <SDL3pp/Point.hpp>
+#include <SDL3pp/Rect.hpp>
+#include <SDL3pp/Renderer.hpp>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Recorded stream of render commands for static scene replay
+ *
+ * A command list is filled once through a Renderer in recording mode (see
+ * Renderer::begin_recording()), then replayed every frame. Commands are
+ * plain structures referencing ranges of geometry arenas, for the points,
+ * the rects and the vertices and indices of the triangles, so a list is a
+ * handful of contiguous buffers whatever its size.
+ *
+ * Consecutive draws of the same kind and state are merged into a single
+ * command, whose bounding box is kept for culling. On replay, a command
+ * entirely outside the viewport is skipped without reading its geometry,
+ * and the primitives of a partially visible command are culled one by one.
+ *
+ * The buffers use a std::pmr allocator, so a list rebuilt every frame can
+ * live in a FrameArena.
+ *
+ * @code {.cpp}
+ * SDL3pp::RenderCommandList background;
+ * renderer.begin_recording(background);
+ * draw_background(renderer);
+ * renderer.end_recording();
+ *
+ * // every frame
+ * background.replay(renderer, -camera_position, screen_rect);
+ * @endcode
+ */
+class RenderCommandList
+{
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    RenderCommandList() = default;
+
+    /**
+     * @brief Construct a new RenderCommandList object allocating from a resource
+     *
+     * @param allocator the allocator of the buffers, such as a FrameArena.
+     */
+    inline explicit RenderCommandList(allocator_type allocator) noexcept;
+
+    RenderCommandList(RenderCommandList const&) = default;
+    RenderCommandList& operator=(RenderCommandList const&) = default;
+
+    RenderCommandList(RenderCommandList&&) = default;
+    RenderCommandList& operator=(RenderCommandList&&) = default;
+
+    ~RenderCommandList() = default;
+
+    /**
+     * @brief Remove every recorded command, keeping the allocated memory
+     */
+    void clear() noexcept;
+
+    inline bool is_empty() const noexcept;
+
+    /**
+     * @brief Get the number of recorded commands
+     */
+    inline std::size_t get_size() const noexcept;
+
+    /**
+     * @brief Get the bounding box of every recorded primitive
+     */
+    inline Rect get_bounds() const noexcept;
+
+    inline allocator_type get_allocator() const noexcept;
+
+    void add_points(std::span<const Point> points, Color const& color, BlendMode blend_mode);
+
+    /**
+     * @brief Record a series of connected lines
+     */
+    void add_lines(std::span<const Point> points, Color const& color, BlendMode blend_mode);
+
+    void add_rects(std::span<const Rect> rects, Color const& color, BlendMode blend_mode, bool filled);
+
+    /**
+     * @brief Record a list of triangles, optionally using a texture
+     *
+     * The texture is not owned by the list, it must outlive the recorded
+     * command.
+     */
+    void add_geometry(SDL_Texture* texture, std::span<const SDL_Vertex> vertices, std::span<const int> indices,
+                      Color const& color, BlendMode blend_mode);
+
+    void add_clear(Color const& color, BlendMode blend_mode);
+
+    /**
+     * @brief Record a change of the rendering target
+     *
+     * @param texture the targeted texture, or nullptr for the window. It is
+     *                not owned by the list, it must outlive the recorded
+     *                command.
+     */
+    void add_target(SDL_Texture* texture);
+
+    /**
+     * @brief Record a change of the blend mode of a texture
+     *
+     * The texture is not owned by the list, it must outlive the recorded
+     * command.
+     */
+    void add_texture_blend_mode(SDL_Texture* texture, BlendMode blend_mode);
+
+    /**
+     * @brief Submit the recorded commands to a renderer
+     *
+     * The target and the texture blend modes are set as recorded, whatever
+     * they are when the list is replayed. The draw color, the blend mode
+     * and the target of the renderer are left to the state of the last
+     * replayed command.
+     *
+     * @param renderer the renderer to draw with.
+     * @param offset the translation applied to every primitive.
+     * @param viewport the visible area, primitives outside of it are not
+     *                 submitted; std::nullopt disables the culling.
+     *
+     * @returns the number of submitted primitives.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    std::size_t replay(Renderer& renderer, Point const& offset = Point(),
+                       std::optional<Rect> const& viewport = std::nullopt) const;
+
+private:
+    enum class Kind : std::uint8_t
+    {
+        clear,
+        points,
+        lines,
+        rects,
+        filled_rects,
+        geometry,
+        target,
+        texture_blend_mode
+    };
+
+    struct Command
+    {
+        Kind kind;
+        Color color;
+        BlendMode blend_mode;
+        std::uint32_t first;
+        std::uint32_t count;
+        Rect bounds;
+    };
+
+    // Range of m_vertices and m_indices of a geometry command, which
+    // references it by its index in m_geometries
+    struct Geometry
+    {
+        SDL_Texture* texture;
+        std::uint32_t first_vertex;
+        std::uint32_t vertex_count;
+        std::uint32_t first_index;
+        std::uint32_t index_count;
+    };
+
+    Command* mergeable(Kind kind, Color const& color, BlendMode blend_mode) noexcept;
+    void extend_bounds(Command& command, Rect const& bounds) noexcept;
+
+    std::pmr::vector<Command> m_commands;
+    std::pmr::vector<Point> m_points;
+    std::pmr::vector<Rect> m_rects;
+    std::pmr::vector<Geometry> m_geometries;
+    std::pmr::vector<SDL_Vertex> m_vertices;
+    std::pmr::vector<int> m_indices;
+    // Textures of the target and texture blend mode commands
+    std::pmr::vector<SDL_Texture*> m_textures;
+    Rect m_bounds;
+    bool m_has_bounds = false;
+    mutable std::pmr::vector<Point> m_scratch_points;
+    mutable std::pmr::vector<Rect> m_scratch_rects;
+    mutable std::pmr::vector<SDL_Vertex> m_scratch_vertices;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/RenderCommandList.inl"
+#endif
@@ -0,0 +1,291 @@
+#ifndef SDL3PP_RENDERER_HPP
+#define SDL3PP_RENDERER_HPP
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <SDL3/SDL_render.h>
+#include <SDL3pp/observer_ptr.hpp>
+#include <SDL3pp/Point.hpp>
+#include <SDL3pp/Rect.hpp>
+#include <SDL3pp/Surface.hpp>
+#include <SDL3pp/Window.hpp>
+#include <SDL3pp/unique_handle.hpp>
+
+namespace SDL3pp
+{
+
+using BlendMode = SDL_BlendMode;
+
+class RenderCommandList;
+
+/**
+ * @brief Counters of the work submitted to SDL by a Renderer
+ *
+ * The counters are accumulated until Renderer::reset_stats() is called,
+ * typically once per frame.
+ */
+struct RenderStats
+{
+    /** Number of SDL_Render* draw calls issued. */
+    std::size_t draw_calls = 0;
+    /** Number of primitives (points, line segments, rects) drawn. */
+    std::size_t primitives = 0;
+    /** Number of draw color, blend mode or target changes sent to SDL. */
+    std::size_t state_changes = 0;
+};
+
+/**
+ * @brief 2D rendering context with batched primitive submission
+ *
+ * Primitive draws (points, lines, rects and filled rects) are not sent to
+ * SDL one by one: they are queued while the draw state (color, blend mode
+ * and target) and the primitive kind stay the same, then flushed with a
+ * single SDL_RenderPoints(), SDL_RenderLines(), SDL_RenderRects() or
+ * SDL_RenderFillRects() call. Submission order is preserved, so the result
+ * is identical to the immediate drawing.
+ *
+ * The queue is flushed when the state or the primitive kind changes, and
+ * before clear(), present() or any call to flush().
+ *
+ * @see https://wiki.libsdl.org/SDL3/CategoryRender
+ */
+class Renderer
+{
+public:
+    Renderer() = delete;
+
+    /**
+     * @brief Construct a new Renderer object for a window
+     *
+     * @param window the window where rendering is displayed.
+     * @param driver the name of the rendering driver to initialize, or
+     *               nullptr to let SDL choose one.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     *
+     * @threadsafety This function should only be called on the main thread.
+     */
+    explicit Renderer(Window& window, const char* driver = nullptr);
+
+    /**
+     * @brief Construct a new software Renderer object drawing on a surface
+     *
+     * This does not need any video driver, so it is suited for headless use.
+     * The surface must outlive the renderer.
+     *
+     * @param surface the surface where rendering is done.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    explicit Renderer(Surface& surface);
+
+    /**
+     * @brief Take the ownership of an existing SDL_Renderer
+     *
+     * @param renderer the renderer to own, it is destroyed with the object.
+     */
+    inline Renderer(SDL_Renderer* renderer);
+
+    Renderer(Renderer const&) = delete;
+    Renderer& operator=(Renderer const&) = delete;
+
+    /**
+     * @brief Move the renderer, its queued primitives and its recording
+     *
+     * The moved-from object is left with nothing queued and not recording.
+     */
+    Renderer(Renderer&& other) noexcept;
+    Renderer& operator=(Renderer&& other);
+
+    ~Renderer() = default;
+
+    /**
+     * @brief Set the color used for drawing operations
+     *
+     * @param color the color used to draw on the rendering target.
+     */
+    inline void set_draw_color(Color const& color);
+
+    inline Color get_draw_color() const noexcept;
+
+    /**
+     * @brief Set the blend mode used for drawing operations
+     *
+     * @param mode the blend mode to use for blending.
+     */
+    inline void set_draw_blend_mode(BlendMode mode);
+
+    inline BlendMode get_draw_blend_mode() const noexcept;
+
+    /**
+     * @brief Set a texture as the current rendering target
+     *
+     * @param texture the targeted texture, which must be created with the
+     *                SDL_TEXTUREACCESS_TARGET flag, or nullptr to render
+     *                to the window instead of a texture.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    void set_target(SDL_Texture* texture);
+
+    inline SDL_Texture* get_target() const noexcept;
+
+    /**
+     * @brief Set the blend mode used to render a texture
+     *
+     * While recording, the change is appended to the command list instead.
+     *
+     * @param texture the texture to change.
+     * @param mode the blend mode to use for texture blending.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    void set_texture_blend_mode(SDL_Texture* texture, BlendMode mode);
+
+    /**
+     * @brief Enable or disable the batching of primitives
+     *
+     * When disabled, every primitive is sent to SDL as soon as it is drawn.
+     * Batching is enabled by default.
+     */
+    void set_batching(bool enabled);
+
+    inline bool is_batching() const noexcept;
+
+    void draw_point(Point const& point);
+
+    void draw_points(std::span<const Point> points);
+
+    /**
+     * @brief Draw a line segment
+     *
+     * Consecutive connected segments are merged into one polyline.
+     */
+    void draw_line(Point const& a, Point const& b);
+
+    /**
+     * @brief Draw a series of connected lines
+     *
+     * @param points the points along the lines.
+     */
+    void draw_lines(std::span<const Point> points);
+
+    void draw_rect(Rect const& rect);
+
+    void draw_rects(std::span<const Rect> rects);
+
+    void fill_rect(Rect const& rect);
+
+    void fill_rects(std::span<const Rect> rects);
+
+    /**
+     * @brief Render a list of triangles, optionally using a texture
+     *
+     * The queued primitives are flushed first, so the geometry is drawn in
+     * submission order on the current target. While recording, the
+     * triangles are appended to the command list, which keeps a pointer
+     * to the texture.
+     *
+     * @param texture the texture to use, or nullptr.
+     * @param vertices the vertices.
+     * @param indices the indices into the vertex array, each three indices
+     *                form a triangle.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    void render_geometry(SDL_Texture* texture, std::span<const SDL_Vertex> vertices, std::span<const int> indices);
+
+    /**
+     * @brief Clear the current rendering target with the drawing color
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    void clear();
+
+    /**
+     * @brief Update the screen with any rendering performed since the previous call
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    void present();
+
+    /**
+     * @brief Submit every queued primitive to SDL
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    void flush();
+
+    /**
+     * @brief Record the following draws into a command list
+     *
+     * Until end_recording() is called, the draw, render_geometry() and
+     * clear functions append commands tagged with the current draw color
+     * and blend mode to the list, and nothing is sent to SDL. The current
+     * target is recorded first, then every change made by set_target() and
+     * set_texture_blend_mode(). The list must outlive the recording.
+     *
+     * @param list the list to append the commands to.
+     */
+    void begin_recording(RenderCommandList& list);
+
+    /**
+     * @brief Stop recording and go back to drawing
+     */
+    inline void end_recording() noexcept;
+
+    inline bool is_recording() const noexcept;
+
+    inline RenderStats const& get_stats() const noexcept;
+
+    inline void reset_stats() noexcept;
+
+    /**
+     * @brief Get the underlying SDL_Renderer
+     *
+     * The queued primitives are not flushed, call flush() before drawing
+     * with the SDL API directly.
+     */
+    inline SDL_Renderer* get() const noexcept;
+
+private:
+    enum class Primitive
+    {
+        none,
+        points,
+        lines,
+        rects,
+        filled_rects
+    };
+
+    struct State
+    {
+        Color color {0, 0, 0, 255};
+        BlendMode blend_mode = SDL_BLENDMODE_NONE;
+        SDL_Texture* target = nullptr;
+    };
+
+    void begin(Primitive primitive);
+    void end_immediate();
+    void apply_state();
+
+    unique_handle<SDL_Renderer, &SDL_DestroyRenderer> m_renderer;
+    State m_state;
+    State m_applied;
+    bool m_applied_valid = false;
+    bool m_batching = true;
+    Primitive m_pending = Primitive::none;
+    Point m_line_end;
+    std::vector<SDL_FPoint> m_points;
+    std::vector<int> m_line_runs;
+    std::vector<SDL_FRect> m_rects;
+    RenderStats m_stats;
+    observer_ptr<RenderCommandList> m_recording;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/Renderer.inl"
+#endif
@@ -6,5 +6,37 @@
 #include <SDL3pp/Window.hpp>
 #include <SDL3pp/Point.hpp>
 #include <SDL3pp/Rect.hpp>
+#include <SDL3pp/Surface.hpp>
+#include <SDL3pp/Renderer.hpp>
+#include <SDL3pp/Texture.hpp>
+#include <SDL3pp/SpriteBatch.hpp>
+#include <SDL3pp/RenderCommandList.hpp>
+#include <SDL3pp/Camera2D.hpp>
+#include <SDL3pp/StreamingTexture.hpp>
+#include <SDL3pp/SpscRing.hpp>
+#include <SDL3pp/AudioStream.hpp>
+#include <SDL3pp/VoiceMixer.hpp>
+#include <SDL3pp/WorkStealingDeque.hpp>
+#include <SDL3pp/JobSystem.hpp>
+#include <SDL3pp/AudioDecoder.hpp>
+#include <SDL3pp/MusicStream.hpp>
+#include <SDL3pp/SmallFunction.hpp>
+#include <SDL3pp/MainThreadQueue.hpp>
+#include <SDL3pp/CoroutineFramePool.hpp>
+#include <SDL3pp/Task.hpp>
+#include <SDL3pp/TimerWheel.hpp>
+#include <SDL3pp/FrameArena.hpp>
+#include <SDL3pp/MemoryTracker.hpp>
+#include <SDL3pp/Profiler.hpp>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/InputState.hpp>
+#include <SDL3pp/EventLog.hpp>
+#include <SDL3pp/EventCoalescer.hpp>
+
+#ifdef SDL3PP_WITH_TTF
+#include <SDL3pp/Font.hpp>
+#include <SDL3pp/GlyphCache.hpp>
+#include <SDL3pp/TextLayout.hpp>
+#endif
 
 #endif 
\ No newline at end of file
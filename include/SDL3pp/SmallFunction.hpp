@@ -0,0 +1,96 @@
+#ifndef SDL3PP_SMALL_FUNCTION_HPP
+#define SDL3PP_SMALL_FUNCTION_HPP
+
+#include <cstddef>
+#include <type_traits>
+
+namespace SDL3pp
+{
+
+template <typename Signature, std::size_t Capacity = 48>
+class SmallFunction;
+
+/**
+ * @brief Move-only callable wrapper with inline storage
+ *
+ * Unlike std::function, whose inline buffer only fits two pointers in
+ * common implementations, callables up to Capacity bytes are stored in the
+ * object itself, so wrapping a lambda with a few captures never allocates.
+ * Larger callables, or callables which may throw when moved, are stored on
+ * the heap. Being move-only, it can hold move-only captures such as a
+ * std::promise.
+ *
+ * @tparam R the return type.
+ * @tparam Args the argument types.
+ * @tparam Capacity the size of the inline storage, in bytes.
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+class SmallFunction<R(Args...), Capacity>
+{
+public:
+    SmallFunction() noexcept = default;
+
+    inline SmallFunction(std::nullptr_t) noexcept;
+
+    /**
+     * @brief Construct a new SmallFunction object wrapping a callable
+     *
+     * @param function the callable, moved or copied into the object.
+     */
+    template <typename F>
+        requires(!std::is_same_v<std::remove_cvref_t<F>, SmallFunction>
+                 && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+    SmallFunction(F&& function);
+
+    SmallFunction(SmallFunction const&) = delete;
+    SmallFunction& operator=(SmallFunction const&) = delete;
+
+    inline SmallFunction(SmallFunction&& other) noexcept;
+    inline SmallFunction& operator=(SmallFunction&& other) noexcept;
+
+    inline ~SmallFunction();
+
+    /**
+     * @brief Call the wrapped callable, which must exist
+     */
+    inline R operator()(Args... args);
+
+    inline explicit operator bool() const noexcept;
+
+    /**
+     * @brief Check whether the callable is stored without allocation
+     */
+    inline bool is_inline() const noexcept;
+
+    /**
+     * @brief Destroy the wrapped callable
+     */
+    inline void reset() noexcept;
+
+private:
+    struct Operations
+    {
+        R (*invoke)(void* storage, Args&&... args);
+        void (*move)(void* from, void* to) noexcept;
+        void (*destroy)(void* storage) noexcept;
+        bool is_inline;
+    };
+
+    template <typename F>
+    static constexpr bool fits_inline = sizeof(F) <= Capacity && alignof(F) <= alignof(std::max_align_t)
+                                     && std::is_nothrow_move_constructible_v<F>;
+
+    template <typename F>
+    struct InlineOperations;
+
+    template <typename F>
+    struct HeapOperations;
+
+    alignas(std::max_align_t) std::byte m_storage[Capacity];
+    Operations const* m_operations = nullptr;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/SmallFunction.inl"
+#endif
@@ -0,0 +1,127 @@
+#ifndef SDL3PP_SPRITE_BATCH_HPP
+#define SDL3PP_SPRITE_BATCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL3/SDL_render.h>
+#include <SDL3pp/Rect.hpp>
+#include <SDL3pp/Renderer.hpp>
+#include <SDL3pp/Texture.hpp>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Texture-sorted batch of sprites submitted with SDL_RenderGeometry
+ *
+ * Sprites are accumulated as quads, then flush() sorts them by
+ * (layer, texture, blend mode) and emits one SDL_RenderGeometry() call per
+ * run of sprites sharing the same texture and blend mode.
+ *
+ * Layers are drawn in ascending order. Inside a layer, sprites using the
+ * same texture keep their submission order, but sprites using different
+ * textures are grouped together: use distinct layers for sprites which
+ * must overlap in a specific order.
+ *
+ * The vertex and index buffers are reused from one flush to the next, so a
+ * batch of steady size does not allocate once it is warmed up.
+ */
+class SpriteBatch
+{
+public:
+    SpriteBatch() = default;
+
+    /**
+     * @brief Construct a new SpriteBatch object with preallocated buffers
+     *
+     * @param capacity the number of sprites expected per flush.
+     */
+    explicit SpriteBatch(std::size_t capacity);
+
+    SpriteBatch(SpriteBatch const&) = delete;
+    SpriteBatch& operator=(SpriteBatch const&) = delete;
+
+    SpriteBatch(SpriteBatch&&) = default;
+    SpriteBatch& operator=(SpriteBatch&&) = default;
+
+    ~SpriteBatch() = default;
+
+    /**
+     * @brief Queue a sprite
+     *
+     * @param texture the texture of the sprite, it must stay alive until the
+     *                next flush().
+     * @param src the region of the texture to draw, in pixels.
+     * @param dst the region of the target to draw to, in pixels.
+     * @param layer the layer of the sprite, lower layers are drawn first.
+     * @param blend_mode the blend mode used to draw the sprite.
+     * @param tint the color multiplied with the texture.
+     */
+    void draw(Texture const& texture, Rect const& src, Rect const& dst,
+              std::uint16_t layer = 0,
+              BlendMode blend_mode = SDL_BLENDMODE_BLEND,
+              Color const& tint = Color{255, 255, 255, 255});
+
+    /**
+     * @brief Queue a sprite drawing the whole texture
+     */
+    void draw(Texture const& texture, Rect const& dst,
+              std::uint16_t layer = 0,
+              BlendMode blend_mode = SDL_BLENDMODE_BLEND,
+              Color const& tint = Color{255, 255, 255, 255});
+
+    /**
+     * @brief Sort the queued sprites and submit them to a renderer
+     *
+     * The batch is empty afterwards.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    void flush(Renderer& renderer);
+
+    /**
+     * @brief Drop every queued sprite
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Get the number of queued sprites
+     */
+    inline std::size_t get_size() const noexcept;
+
+    /**
+     * @brief Get the number of draw calls issued by the last flush()
+     */
+    inline std::size_t get_draw_calls() const noexcept;
+
+private:
+    struct Sprite
+    {
+        SDL_FRect dst;
+        SDL_FRect uv;
+        SDL_FColor color;
+    };
+
+    std::uint32_t texture_slot(SDL_Texture* texture);
+    std::uint32_t blend_mode_slot(BlendMode blend_mode);
+
+    std::vector<Sprite> m_sprites;
+    std::vector<std::uint64_t> m_keys;
+    std::vector<std::uint64_t> m_keys_swap;
+    std::vector<std::uint32_t> m_order;
+    std::vector<std::uint32_t> m_order_swap;
+    std::vector<SDL_Texture*> m_textures;
+    std::unordered_map<SDL_Texture*, std::uint32_t> m_texture_slots;
+    std::vector<BlendMode> m_blend_modes;
+    std::vector<SDL_Vertex> m_vertices;
+    std::vector<int> m_indices;
+    std::size_t m_draw_calls = 0;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/SpriteBatch.inl"
+#endif
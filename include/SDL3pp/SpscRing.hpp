@@ -0,0 +1,109 @@
+#ifndef SDL3PP_SPSC_RING_HPP
+#define SDL3PP_SPSC_RING_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Wait-free single-producer single-consumer ring buffer
+ *
+ * One thread writes and one thread reads, without any lock: each side only
+ * stores its own index and reads the other one, so neither side can block
+ * or be preempted while holding something the other needs. This makes it
+ * suited to hand data over to a real-time thread such as the audio
+ * callback.
+ *
+ * The capacity is rounded up to a power of two. The read and write indices
+ * live on separate cache lines, and each side caches the last index seen
+ * from the other one, so the shared cache lines are only touched when the
+ * cached view is not enough.
+ *
+ * @tparam T the type of the items, which must be trivially copyable.
+ */
+template <typename T>
+class SpscRing
+{
+    static_assert(std::is_trivially_copyable_v<T>, "SpscRing items must be trivially copyable");
+
+public:
+    SpscRing() = delete;
+
+    /**
+     * @brief Construct a new SpscRing object
+     *
+     * @param capacity the minimum number of items the ring can hold.
+     */
+    explicit SpscRing(std::size_t capacity);
+
+    SpscRing(SpscRing const&) = delete;
+    SpscRing& operator=(SpscRing const&) = delete;
+
+    SpscRing(SpscRing&&) = delete;
+    SpscRing& operator=(SpscRing&&) = delete;
+
+    ~SpscRing() = default;
+
+    /**
+     * @brief Append items
+     *
+     * @param items the items to append.
+     * @returns the number of items appended, less than the size of items if
+     *          the ring is full.
+     *
+     * @threadsafety This function should only be called by the producer.
+     */
+    std::size_t write(std::span<const T> items) noexcept;
+
+    /**
+     * @brief Remove the oldest items
+     *
+     * @param items where the items are copied.
+     * @returns the number of items removed, less than the size of items if
+     *          the ring is drained.
+     *
+     * @threadsafety This function should only be called by the consumer.
+     */
+    std::size_t read(std::span<T> items) noexcept;
+
+    /**
+     * @brief Get the number of items which can be read
+     *
+     * The value is exact for the consumer and a lower bound for the
+     * producer.
+     */
+    inline std::size_t get_size() const noexcept;
+
+    /**
+     * @brief Get the number of items which can be written
+     *
+     * The value is exact for the producer and a lower bound for the
+     * consumer.
+     */
+    inline std::size_t get_free() const noexcept;
+
+    inline std::size_t get_capacity() const noexcept;
+
+private:
+    // Separate the indices to avoid false sharing between the two threads
+    static constexpr std::size_t cache_line_size = 64;
+
+    std::unique_ptr<T[]> m_items;
+    std::size_t m_mask;
+
+    alignas(cache_line_size) std::atomic<std::size_t> m_write_index {0};
+    std::size_t m_cached_read_index = 0;
+
+    alignas(cache_line_size) std::atomic<std::size_t> m_read_index {0};
+    std::size_t m_cached_write_index = 0;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/SpscRing.inl"
+#endif
@@ -0,0 +1,248 @@
+#ifndef SDL3PP_STREAMING_TEXTURE_HPP
+#define SDL3PP_STREAMING_TEXTURE_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include <SDL3pp/Rect.hpp>
+#include <SDL3pp/Renderer.hpp>
+#include <SDL3pp/Texture.hpp>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Counters of a StreamingTexture
+ *
+ * The counters are accumulated until StreamingTexture::reset_stats() is
+ * called, typically once per frame.
+ */
+struct StreamingTextureStats
+{
+    /** Number of frames submitted by the producers. */
+    std::size_t frames_submitted = 0;
+    /** Number of frames uploaded to a texture. */
+    std::size_t frames_uploaded = 0;
+    /** Number of submitted frames superseded by a newer one before upload. */
+    std::size_t frames_dropped = 0;
+    /** Number of pixel bytes sent to SDL_UpdateTexture(). */
+    std::size_t upload_bytes = 0;
+    /** Time spent by the render thread uploading. */
+    std::chrono::nanoseconds upload_time {0};
+    /** Time spent by the producers waiting for a free staging buffer. */
+    std::chrono::nanoseconds stall_time {0};
+};
+
+/**
+ * @brief Texture updated every frame from producer threads
+ *
+ * The helper rotates through N streaming textures and N staging buffers in
+ * system memory. A producer thread acquires a staging buffer, draws into it
+ * and declares the changed areas with Frame::mark_dirty(), then submits
+ * it. The render thread calls update() once per frame: it uploads the
+ * latest submitted frame into the least recently used texture, copying
+ * only the areas changed since that texture was last written, and makes
+ * it the current texture. The texture being displayed is never updated.
+ *
+ * Staging buffers only hold the areas changed by their own frame. When a
+ * buffer is acquired, the areas changed by the frames submitted since its
+ * previous use are first copied from the latest frame, so every submitted
+ * buffer holds the complete image.
+ *
+ * One frame can be in production at a time, but it can be filled by
+ * several threads as long as they write disjoint areas and mark_dirty()
+ * is only called from one of them.
+ *
+ * @code {.cpp}
+ * SDL3pp::StreamingTexture video(renderer, 1920, 1080);
+ *
+ * // decoder thread
+ * auto frame = video.acquire();
+ * decode_into(frame.get_pixels(), frame.get_pitch());
+ * frame.mark_dirty(changed_area);
+ * frame.submit();
+ *
+ * // render thread, each frame
+ * video.update();
+ * sprites.draw(video.get_texture(), screen_rect);
+ * @endcode
+ */
+class StreamingTexture
+{
+public:
+    /**
+     * @brief Staging buffer handed to a producer
+     *
+     * A frame destroyed without being submitted is cancelled.
+     */
+    class Frame
+    {
+    public:
+        Frame() = delete;
+
+        Frame(Frame const&) = delete;
+        Frame& operator=(Frame const&) = delete;
+
+        inline Frame(Frame&& other) noexcept;
+        Frame& operator=(Frame&& other) = delete;
+
+        inline ~Frame();
+
+        /**
+         * @brief Get the staging pixels, in the format of the texture
+         */
+        inline void* get_pixels() const noexcept;
+
+        /**
+         * @brief Get the number of bytes in a row of staging pixels
+         */
+        inline int get_pitch() const noexcept;
+
+        inline int get_width() const noexcept;
+
+        inline int get_height() const noexcept;
+
+        /**
+         * @brief Declare an area changed by this frame
+         *
+         * The area is clipped to the texture.
+         */
+        void mark_dirty(Rect const& rect);
+
+        /**
+         * @brief Declare the whole frame changed
+         */
+        void mark_all_dirty();
+
+        /**
+         * @brief Hand the frame over to the render thread
+         */
+        void submit();
+
+    private:
+        friend class StreamingTexture;
+
+        inline Frame(StreamingTexture& owner, std::size_t slot) noexcept;
+
+        StreamingTexture* m_owner;
+        std::size_t m_slot;
+    };
+
+    StreamingTexture() = delete;
+
+    /**
+     * @brief Construct a new StreamingTexture object
+     *
+     * @param renderer the rendering context.
+     * @param w the width of the textures in pixels.
+     * @param h the height of the textures in pixels.
+     * @param format the pixel format of the textures and staging buffers.
+     * @param count the number of textures and staging buffers, at least 2.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     *
+     * @threadsafety This function should only be called on the main thread.
+     */
+    StreamingTexture(Renderer& renderer, int w, int h,
+                     PixelFormat format = SDL_PIXELFORMAT_RGBA32, std::size_t count = 3);
+
+    StreamingTexture(StreamingTexture const&) = delete;
+    StreamingTexture& operator=(StreamingTexture const&) = delete;
+
+    StreamingTexture(StreamingTexture&&) = delete;
+    StreamingTexture& operator=(StreamingTexture&&) = delete;
+
+    ~StreamingTexture() = default;
+
+    /**
+     * @brief Wait for a free staging buffer
+     *
+     * The waiting time is accounted in StreamingTextureStats::stall_time.
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    Frame acquire();
+
+    /**
+     * @brief Get a free staging buffer if there is one, without waiting
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    std::optional<Frame> try_acquire();
+
+    /**
+     * @brief Upload the latest submitted frame, if any
+     *
+     * @returns true if a new frame became current.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     *
+     * @threadsafety This function should only be called on the render thread.
+     */
+    bool update();
+
+    /**
+     * @brief Get the texture holding the latest uploaded frame
+     */
+    inline Texture const& get_texture() const noexcept;
+
+    inline int get_width() const noexcept;
+
+    inline int get_height() const noexcept;
+
+    StreamingTextureStats get_stats() const;
+
+    void reset_stats();
+
+private:
+    enum class SlotState
+    {
+        free,
+        writing,
+        ready,
+        uploading
+    };
+
+    struct Slot
+    {
+        std::vector<unsigned char> pixels;
+        std::vector<Rect> dirty;
+        std::vector<Rect> stale;
+        SlotState state = SlotState::free;
+        std::uint64_t sequence = 0;
+    };
+
+    std::optional<std::size_t> find_free_slot() const noexcept;
+    Frame start_frame(std::unique_lock<std::mutex>& lock, std::size_t slot);
+    void submit(std::size_t slot);
+    void cancel(std::size_t slot);
+    void add_region(std::vector<Rect>& regions, Rect const& rect) const;
+    void copy_region(Slot const& src, Slot& dst, Rect const& rect) const noexcept;
+    unsigned char* pixels_at(Slot& slot, Rect const& rect) const noexcept;
+
+    int m_width;
+    int m_height;
+    int m_pitch;
+    int m_bytes_per_pixel;
+    std::vector<Texture> m_textures;
+    std::vector<std::vector<Rect>> m_owed;
+    std::vector<Slot> m_slots;
+    std::vector<Rect> m_upload_regions;
+    std::size_t m_current = 0;
+    std::optional<std::size_t> m_latest;
+    std::uint64_t m_sequence = 0;
+    bool m_writing = false;
+    StreamingTextureStats m_stats;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_slot_freed;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/StreamingTexture.inl"
+#endif
@@ -0,0 +1,163 @@
+#ifndef SDL3PP_SURFACE_HPP
+#define SDL3PP_SURFACE_HPP
+
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#include <SDL3/SDL_surface.h>
+#include <SDL3pp/Point.hpp>
+#include <SDL3pp/Rect.hpp>
+#include <SDL3pp/unique_handle.hpp>
+
+namespace SDL3pp
+{
+
+using Color = SDL_Color;
+using PixelFormat = SDL_PixelFormat;
+
+/**
+ * @brief Collection of pixels in system memory
+ *
+ * Surfaces are the CPU side images of SDL. They are also the render target
+ * of the software renderer, which makes them the natural backend for
+ * headless rendering (tests, benchmarks, servers).
+ *
+ * @see https://wiki.libsdl.org/SDL3/SDL_Surface
+ */
+class Surface
+{
+public:
+    Surface() = delete;
+
+    /**
+     * @brief Construct a new Surface object
+     *
+     * Allocate a new surface with a specific pixel format. The pixels of the
+     * new surface are initialized to zero.
+     *
+     * @param w the width of the surface.
+     * @param h the height of the surface.
+     * @param format the pixel format of the surface.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    Surface(int w, int h, PixelFormat format = SDL_PIXELFORMAT_RGBA32);
+
+    /**
+     * @brief Take the ownership of an existing SDL_Surface
+     *
+     * @param surface the surface to own, it is destroyed with the object.
+     */
+    inline Surface(SDL_Surface* surface);
+
+    Surface(Surface const&) = delete;
+    Surface& operator=(Surface const&) = delete;
+
+    Surface(Surface&&) = default;
+    Surface& operator=(Surface&&) = default;
+
+    ~Surface() = default;
+
+    inline int get_width() const noexcept;
+
+    inline int get_height() const noexcept;
+
+    inline std::pair<int, int> get_size() const noexcept;
+
+    inline int get_pitch() const noexcept;
+
+    inline PixelFormat get_format() const noexcept;
+
+    /**
+     * @brief Get the pixels of the surface
+     *
+     * @warning lock the surface first if it is RLE encoded
+     */
+    inline void* get_pixels() const noexcept;
+
+    /**
+     * @brief Map a color to a pixel value of the surface format
+     *
+     * @param color the color to map.
+     * @returns the pixel value.
+     */
+    inline Uint32 map_color(Color const& color) const noexcept;
+
+    /**
+     * @brief Fill a rectangle with a specific color
+     *
+     * @param rect the rectangle to fill.
+     * @param color the color to fill with.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    inline void fill_rect(Rect const& rect, Color const& color);
+
+    /**
+     * @brief Fill a set of rectangles with a specific color in one call
+     *
+     * The rectangles are handed over to SDL without any copy.
+     *
+     * @param rects the rectangles to fill.
+     * @param color the color to fill with.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    inline void fill_rects(std::span<const Rect> rects, Color const& color);
+
+    /**
+     * @brief Fill the whole surface with a specific color
+     *
+     * @param color the color to fill with.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    inline void fill(Color const& color);
+
+    /**
+     * @brief Perform a fast blit from this surface to the destination surface
+     *
+     * @param src_rect the rectangle to copy, or std::nullopt for the whole
+     *                 surface.
+     * @param dst the destination surface.
+     * @param position the position of the copy in the destination surface.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    inline void blit(std::optional<Rect> const& src_rect, Surface& dst, Point const& position) const;
+
+    /**
+     * @brief Copy the surface into a new surface of another pixel format
+     *
+     * @param format the pixel format of the new surface.
+     * @returns the converted surface.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    inline Surface convert(PixelFormat format) const;
+
+    /**
+     * @brief Get the underlying SDL_Surface
+     *
+     * The ownership is kept by the Surface object.
+     */
+    inline SDL_Surface* get() const noexcept;
+
+private:
+    unique_handle<SDL_Surface, &SDL_DestroySurface> m_surface;
+};
+
+// A single handle, relocated by a std::memcpy
+template <>
+struct is_trivially_relocatable<Surface> : std::true_type
+{
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/Surface.inl"
+#endif
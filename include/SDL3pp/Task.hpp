@@ -0,0 +1,455 @@
+#ifndef SDL3PP_TASK_HPP
+#define SDL3PP_TASK_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3pp/CoroutineFramePool.hpp>
+#include <SDL3pp/JobSystem.hpp>
+#include <SDL3pp/MainThreadQueue.hpp>
+#include <SDL3pp/Surface.hpp>
+#include <SDL3pp/unique_handle.hpp>
+
+namespace SDL3pp
+{
+
+class TaskScheduler;
+
+template <typename T = void>
+class Task;
+
+/**
+ * @brief Part of the promise of a Task which does not depend on its result
+ */
+class TaskPromiseBase
+{
+public:
+    /**
+     * @brief Allocate the coroutine frame from the CoroutineFramePool
+     */
+    inline static void* operator new(std::size_t size);
+
+    inline static void operator delete(void* frame, std::size_t size) noexcept;
+
+    // Tasks start when awaited or spawned
+    inline std::suspend_always initial_suspend() const noexcept;
+
+    inline auto final_suspend() noexcept;
+
+    inline void unhandled_exception() noexcept;
+
+    /**
+     * @brief Get the scheduler running the task, null until it starts
+     */
+    inline TaskScheduler* get_scheduler() const noexcept;
+
+protected:
+    TaskPromiseBase() = default;
+
+    inline void rethrow_if_failed() const;
+
+private:
+    friend class TaskScheduler;
+    template <typename>
+    friend class Task;
+
+    // Resumes the awaiting task, or lets the scheduler destroy a spawned one
+    struct FinalAwaiter
+    {
+        inline bool await_ready() const noexcept;
+        inline std::coroutine_handle<> await_suspend(std::coroutine_handle<> handle) noexcept;
+        inline void await_resume() const noexcept;
+
+        TaskPromiseBase* promise;
+    };
+
+    TaskScheduler* m_scheduler = nullptr;
+    std::coroutine_handle<> m_continuation;
+    std::exception_ptr m_exception;
+
+    // Set for the tasks given to TaskScheduler::spawn(), which keeps them
+    // in a list to destroy the unfinished ones
+    std::coroutine_handle<> m_spawned_handle;
+    TaskPromiseBase* m_previous_spawned = nullptr;
+    TaskPromiseBase* m_next_spawned = nullptr;
+};
+
+/**
+ * @brief Promise of a Task
+ *
+ * @tparam T the result of the task.
+ */
+template <typename T>
+class TaskPromise : public TaskPromiseBase
+{
+    static_assert(!std::is_reference_v<T>, "Task results are returned by value");
+
+public:
+    inline Task<T> get_return_object() noexcept;
+
+    template <typename U>
+        requires std::convertible_to<U&&, T>
+    void return_value(U&& value);
+
+    T take_result();
+
+private:
+    std::optional<T> m_result;
+};
+
+template <>
+class TaskPromise<void> : public TaskPromiseBase
+{
+public:
+    inline Task<void> get_return_object() noexcept;
+
+    inline void return_void() const noexcept;
+
+    inline void take_result() const;
+};
+
+/**
+ * @brief Coroutine running on the main thread under a TaskScheduler
+ *
+ * A Task is lazy: its body starts when it is awaited by another Task, or
+ * when it is given to TaskScheduler::spawn(). It can then suspend itself
+ * until the next frame with next_frame(), for some time with delay(), or
+ * until a surface is loaded in the background with load_surface(), instead
+ * of being written as a state machine polled each frame. Awaiting a Task
+ * returns its result, or rethrows the exception which ended it.
+ *
+ * Coroutine frames are allocated by the CoroutineFramePool, and the
+ * scheduler keeps its waiting lists across frames, so neither starting a
+ * task nor suspending it touches the heap once the program runs steadily.
+ *
+ * @code {.cpp}
+ * SDL3pp::Task<SDL3pp::Surface> load_and_fade(SDL3pp::Window& window)
+ * {
+ *     SDL3pp::Surface image = co_await SDL3pp::load_surface("title.png");
+ *     for (int frame = 0; frame < 60; ++frame)
+ *         co_await SDL3pp::next_frame();
+ *     co_await SDL3pp::delay(std::chrono::milliseconds(500));
+ *     co_return image;
+ * }
+ * @endcode
+ *
+ * @tparam T the result of the task.
+ */
+template <typename T>
+class Task
+{
+    class Awaiter;
+
+public:
+    using promise_type = TaskPromise<T>;
+
+    Task() = delete;
+
+    Task(Task const&) = delete;
+    Task& operator=(Task const&) = delete;
+
+    inline Task(Task&& other) noexcept;
+    inline Task& operator=(Task&& other) noexcept;
+
+    /**
+     * @brief Destroy the task, with its coroutine frame if it did not finish
+     */
+    inline ~Task();
+
+    /**
+     * @brief Check whether the coroutine ran to its end
+     */
+    inline bool is_done() const noexcept;
+
+    /**
+     * @brief Start or wait for the task from another Task
+     *
+     * The awaiting task is resumed when this one ends, without going
+     * through the scheduler.
+     */
+    inline Awaiter operator co_await() noexcept;
+
+private:
+    friend class TaskPromise<T>;
+    friend class TaskScheduler;
+
+    inline explicit Task(std::coroutine_handle<promise_type> handle) noexcept;
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+/**
+ * @brief Counters of a TaskScheduler
+ */
+struct TaskSchedulerStats
+{
+    /** Number of tasks given to spawn(). */
+    std::size_t spawned_tasks = 0;
+    /** Number of spawned tasks which ran to their end. */
+    std::size_t finished_tasks = 0;
+    /** Number of coroutines resumed by update(). */
+    std::size_t resumptions = 0;
+    /** Number of surfaces loaded by load_surface(). */
+    std::size_t loaded_surfaces = 0;
+};
+
+/**
+ * @brief Frame-driven scheduler of Task coroutines
+ *
+ * The main loop calls update() once per frame. The coroutines which became
+ * ready since the previous call, because they awaited next_frame(), their
+ * delay() is over or their load_surface() is done, are collected into one
+ * batch and resumed in turn. A coroutine awaiting next_frame() again while
+ * the batch runs waits for the next update().
+ *
+ * Delays are measured against the time given to update(), usually
+ * SDL_GetTicks(), so a task never sees time moving within a frame. Surfaces
+ * are loaded by jobs of a JobSystem, which hand the finished loads back
+ * through a MainThreadQueue drained by update().
+ *
+ * @code {.cpp}
+ * SDL3pp::TaskScheduler scheduler;
+ * scheduler.spawn(intro_sequence(window));
+ *
+ * // main loop, each frame
+ * scheduler.update();
+ * @endcode
+ */
+class TaskScheduler
+{
+public:
+    class NextFrameAwaiter;
+    class DelayAwaiter;
+    class LoadSurfaceAwaiter;
+
+    /**
+     * @brief Construct a new TaskScheduler object
+     *
+     * @param jobs the pool loading the surfaces.
+     */
+    explicit TaskScheduler(JobSystem& jobs = JobSystem::get_instance());
+
+    TaskScheduler(TaskScheduler const&) = delete;
+    TaskScheduler& operator=(TaskScheduler const&) = delete;
+
+    // The coroutines and the loading jobs keep the address of the object
+    TaskScheduler(TaskScheduler&&) = delete;
+    TaskScheduler& operator=(TaskScheduler&&) = delete;
+
+    /**
+     * @brief Wait for the pending loads and destroy the unfinished tasks
+     */
+    ~TaskScheduler();
+
+    /**
+     * @brief Start a task, which runs until its first suspension
+     *
+     * The scheduler owns the task until it ends.
+     *
+     * @param task the task.
+     *
+     * @exception any exception ending the task before its first suspension
+     *
+     * @threadsafety This function should only be called by the main thread.
+     */
+    void spawn(Task<void> task);
+
+    /**
+     * @brief Resume the coroutines ready for the frame starting now
+     *
+     * @returns the number of coroutines resumed.
+     *
+     * @exception any exception ending a spawned task, rethrown once the
+     *            batch is done
+     *
+     * @threadsafety This function should only be called by the main thread.
+     */
+    std::size_t update();
+
+    /**
+     * @brief Resume the coroutines ready for the frame starting at a given time
+     *
+     * @param ticks the time of the frame, in milliseconds, such as a fixed
+     *              step clock. It should not go backward.
+     * @returns the number of coroutines resumed.
+     *
+     * @exception any exception ending a spawned task, rethrown once the
+     *            batch is done
+     *
+     * @threadsafety This function should only be called by the main thread.
+     */
+    std::size_t update(Uint64 ticks);
+
+    /**
+     * @brief Get the time given to the last update(), in milliseconds
+     */
+    inline Uint64 get_ticks() const noexcept;
+
+    /**
+     * @brief Get the number of calls to update()
+     */
+    inline std::uint64_t get_frame() const noexcept;
+
+    /**
+     * @brief Get the number of spawned tasks which did not end
+     */
+    inline std::size_t get_task_count() const noexcept;
+
+    TaskSchedulerStats get_stats() const noexcept;
+
+    void reset_stats() noexcept;
+
+private:
+    struct Timer
+    {
+        Uint64 deadline;
+        // Resumes the timers of equal deadlines in order
+        std::uint64_t sequence;
+        std::coroutine_handle<> handle;
+    };
+
+    friend class TaskPromiseBase;
+
+    inline static bool is_later(Timer const& a, Timer const& b) noexcept;
+
+    void finish(TaskPromiseBase& promise) noexcept;
+    void load(LoadSurfaceAwaiter& awaiter, std::coroutine_handle<> handle);
+
+    JobSystem& m_jobs;
+    JobSystem::Counter m_loads;
+    MainThreadQueue m_completions;
+
+    // Kept across frames so their capacity is reused
+    std::vector<std::coroutine_handle<>> m_next_frame;
+    std::vector<std::coroutine_handle<>> m_ready;
+    std::vector<std::coroutine_handle<>> m_batch;
+    // Min-heap on the deadlines
+    std::vector<Timer> m_timers;
+
+    TaskPromiseBase* m_spawned = nullptr;
+    std::size_t m_task_count = 0;
+    std::exception_ptr m_failure;
+
+    Uint64 m_ticks = 0;
+    std::uint64_t m_frame = 0;
+    std::uint64_t m_timer_sequence = 0;
+    TaskSchedulerStats m_stats;
+};
+
+/**
+ * @brief Awaitable suspending a Task until the next TaskScheduler::update()
+ */
+class TaskScheduler::NextFrameAwaiter
+{
+public:
+    inline bool await_ready() const noexcept;
+
+    template <std::derived_from<TaskPromiseBase> Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle);
+
+    inline void await_resume() const noexcept;
+};
+
+/**
+ * @brief Awaitable suspending a Task for some time
+ */
+class TaskScheduler::DelayAwaiter
+{
+public:
+    inline explicit DelayAwaiter(std::chrono::milliseconds duration) noexcept;
+
+    inline bool await_ready() const noexcept;
+
+    template <std::derived_from<TaskPromiseBase> Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle);
+
+    inline void await_resume() const noexcept;
+
+private:
+    std::chrono::milliseconds m_duration;
+};
+
+/**
+ * @brief Awaitable suspending a Task while a surface is loaded by a job
+ */
+class TaskScheduler::LoadSurfaceAwaiter
+{
+public:
+    inline explicit LoadSurfaceAwaiter(std::string path) noexcept;
+
+    LoadSurfaceAwaiter(LoadSurfaceAwaiter const&) = delete;
+    LoadSurfaceAwaiter& operator=(LoadSurfaceAwaiter const&) = delete;
+
+    // The loading job keeps the address of the object
+    LoadSurfaceAwaiter(LoadSurfaceAwaiter&&) = delete;
+    LoadSurfaceAwaiter& operator=(LoadSurfaceAwaiter&&) = delete;
+
+    ~LoadSurfaceAwaiter() = default;
+
+    inline bool await_ready() const noexcept;
+
+    template <std::derived_from<TaskPromiseBase> Promise>
+    void await_suspend(std::coroutine_handle<Promise> handle);
+
+    /**
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    Surface await_resume();
+
+private:
+    friend class TaskScheduler;
+
+    std::string m_path;
+    // Destroys the surface loaded for a task destroyed before it resumed
+    unique_handle<SDL_Surface, &SDL_DestroySurface> m_surface;
+    std::string m_error;
+};
+
+/**
+ * @brief Suspend the calling Task until the next frame
+ *
+ * @threadsafety This function should only be called by the main thread.
+ */
+inline TaskScheduler::NextFrameAwaiter next_frame() noexcept;
+
+/**
+ * @brief Suspend the calling Task for some time
+ *
+ * The task resumes at the first update() at least duration after the
+ * current frame, or goes on at once if duration is not positive.
+ *
+ * @param duration the time to wait.
+ *
+ * @threadsafety This function should only be called by the main thread.
+ */
+inline TaskScheduler::DelayAwaiter delay(std::chrono::milliseconds duration) noexcept;
+
+/**
+ * @brief Suspend the calling Task until an image file is loaded
+ *
+ * The file is loaded by a job of the JobSystem of the scheduler, with
+ * IMG_Load() when SDL3_image is enabled and SDL_LoadBMP() otherwise, and
+ * the task resumes with the surface at the following update().
+ *
+ * @param path the path of the file.
+ *
+ * @exception SDL3pp::Exception call exception.what() for more information about this
+ *
+ * @threadsafety This function should only be called by the main thread.
+ */
+inline TaskScheduler::LoadSurfaceAwaiter load_surface(std::string path);
+
+} // namespace SDL3pp
+
+#include "inline_src/Task.inl"
+#endif
@@ -0,0 +1,305 @@
+#ifndef SDL3PP_TEXT_LAYOUT_HPP
+#define SDL3PP_TEXT_LAYOUT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <SDL3pp/Font.hpp>
+#include <SDL3pp/GlyphCache.hpp>
+#include <SDL3pp/observer_ptr.hpp>
+#include <SDL3pp/Point.hpp>
+#include <SDL3pp/Rect.hpp>
+#include <SDL3pp/SpriteBatch.hpp>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Counters of a TextLayout
+ *
+ * The counters are accumulated until TextLayout::reset_stats() is called.
+ */
+struct TextLayoutStats
+{
+    /** Number of paragraphs measured and broken into lines. */
+    std::size_t shaped_paragraphs = 0;
+    /** Number of glyphs measured. */
+    std::size_t shaped_glyphs = 0;
+};
+
+/**
+ * @brief Line of a TextLayout returned by the queries
+ */
+struct TextLine
+{
+    std::size_t paragraph;
+    std::size_t line;
+    /** Bounds of the line in layout coordinates. */
+    Rect bounds;
+    /** Text of the line, valid until the layout is modified. */
+    std::string_view text;
+};
+
+/**
+ * @brief Position in the text of a TextLayout
+ */
+struct TextPosition
+{
+    std::size_t paragraph;
+    /** Byte offset in the paragraph. */
+    std::size_t offset;
+};
+
+/**
+ * @brief Word-wrapped multi-paragraph text with cached incremental layout
+ *
+ * The text is split into paragraphs on '\n'. Each paragraph caches its
+ * shaped glyphs (positions including kerning) and its line breaks, so an
+ * edit only lays out the edited paragraph again.
+ *
+ * Paragraphs are shaped lazily, when a query reaches them: the layout of a
+ * long document only costs the lines actually displayed. Until it is
+ * shaped, a paragraph is given a height estimated from its length, so the
+ * positions below unshaped paragraphs are approximate and become exact as
+ * they are shaped. Paragraph heights are kept in a Fenwick tree, finding
+ * the paragraph at a given height and updating one height are O(log n).
+ *
+ * Call invalidate() after changing the size or the style of the font.
+ *
+ * @code {.cpp}
+ * SDL3pp::TextLayout log(font, 400);
+ * log.set_text(history);
+ * log.insert_text(log.get_paragraph_count() - 1, 0, "new message");
+ * log.draw(glyphs, batch, SDL3pp::Point(0, -scroll), SDL3pp::Rect(0, scroll, 400, 300));
+ * @endcode
+ */
+class TextLayout
+{
+public:
+    TextLayout() = delete;
+
+    /**
+     * @brief Construct a new empty TextLayout object
+     *
+     * @param font the font of the text, it must outlive the layout.
+     * @param wrap_width the width where lines are wrapped, in pixels, or 0 to
+     *                   only break lines at the end of paragraphs.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    explicit TextLayout(Font const& font, int wrap_width = 0);
+
+    TextLayout(TextLayout const&) = delete;
+    TextLayout& operator=(TextLayout const&) = delete;
+
+    TextLayout(TextLayout&&) = default;
+    TextLayout& operator=(TextLayout&&) = default;
+
+    ~TextLayout() = default;
+
+    /**
+     * @brief Replace the whole text
+     *
+     * Nothing is shaped until a query needs it.
+     */
+    void set_text(std::string_view text);
+
+    /**
+     * @brief Get the whole text, with the paragraphs joined by '\n'
+     */
+    std::string get_text() const;
+
+    inline std::size_t get_paragraph_count() const noexcept;
+
+    inline std::string_view get_paragraph(std::size_t paragraph) const noexcept;
+
+    /**
+     * @brief Replace the text of a paragraph
+     *
+     * @param paragraph the index of the paragraph.
+     * @param text the new text, without '\n'.
+     */
+    void set_paragraph(std::size_t paragraph, std::string_view text);
+
+    /**
+     * @brief Insert a paragraph before another one
+     *
+     * @param paragraph the index of the new paragraph, up to
+     *                  get_paragraph_count().
+     * @param text the text of the paragraph, without '\n'.
+     */
+    void insert_paragraph(std::size_t paragraph, std::string_view text);
+
+    void erase_paragraph(std::size_t paragraph);
+
+    /**
+     * @brief Insert text in a paragraph
+     *
+     * A '\n' in the text splits the paragraph.
+     *
+     * @param paragraph the index of the paragraph.
+     * @param offset the byte offset of the insertion in the paragraph.
+     * @param text the text to insert.
+     */
+    void insert_text(std::size_t paragraph, std::size_t offset, std::string_view text);
+
+    /**
+     * @brief Erase text in a paragraph
+     *
+     * @param paragraph the index of the paragraph.
+     * @param offset the byte offset of the first erased byte.
+     * @param count the number of bytes to erase.
+     */
+    void erase_text(std::size_t paragraph, std::size_t offset, std::size_t count);
+
+    /**
+     * @brief Set the width where lines are wrapped
+     *
+     * Every paragraph is laid out again when needed.
+     */
+    void set_wrap_width(int wrap_width);
+
+    inline int get_wrap_width() const noexcept;
+
+    /**
+     * @brief Drop every cached layout, after a change of the font
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    void invalidate();
+
+    /**
+     * @brief Get the height of the whole text, in pixels
+     *
+     * The height of the unshaped paragraphs is estimated.
+     */
+    inline int get_height() const noexcept;
+
+    /**
+     * @brief Get the lines crossing the vertical span of an area
+     *
+     * Only the paragraphs reached by the area are shaped.
+     *
+     * @param area the area to query, in layout coordinates.
+     * @param lines the vector receiving the lines, it is cleared first.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    void get_lines(Rect const& area, std::vector<TextLine>& lines);
+
+    /**
+     * @brief Get the lines crossing the vertical span of an area
+     *
+     * Only the paragraphs reached by the area are shaped.
+     *
+     * @param area the area to query, in layout coordinates.
+     * @param allocator the allocator of the result, such as a FrameArena.
+     * @returns the lines.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    std::pmr::vector<TextLine> get_lines(Rect const& area, std::pmr::polymorphic_allocator<TextLine> allocator = {});
+
+    /**
+     * @brief Get the bounds of a line of a paragraph
+     *
+     * @returns the bounds in layout coordinates, or std::nullopt if the
+     *          paragraph has no such line.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    std::optional<Rect> get_line_bounds(std::size_t paragraph, std::size_t line);
+
+    /**
+     * @brief Find the text position closest to a point
+     *
+     * @param point the point in layout coordinates.
+     * @returns the position of the glyph boundary closest to the point, or
+     *          std::nullopt if the layout is empty.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    std::optional<TextPosition> hit_test(Point const& point);
+
+    /**
+     * @brief Queue the lines crossing the vertical span of an area into a
+     *        sprite batch
+     *
+     * @param glyphs the glyph cache used to draw.
+     * @param batch the batch to queue the quads into.
+     * @param origin the position of the layout origin on the target.
+     * @param area the area to draw, in layout coordinates.
+     * @param color the color of the text.
+     * @param layer the layer of the quads in the batch.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    void draw(GlyphCache& glyphs, SpriteBatch& batch, Point const& origin, Rect const& area,
+              Color const& color = Color{255, 255, 255, 255}, std::uint16_t layer = 0);
+
+    inline TextLayoutStats const& get_stats() const noexcept;
+
+    inline void reset_stats() noexcept;
+
+private:
+    struct Glyph
+    {
+        /** Byte offset of the glyph in the paragraph. */
+        std::uint32_t offset;
+        /** Position of the glyph from the start of the paragraph. */
+        int x;
+    };
+
+    struct Line
+    {
+        std::uint32_t first_glyph;
+        std::uint32_t end_glyph;
+        int x;
+        int width;
+    };
+
+    struct Paragraph
+    {
+        std::string text;
+        std::vector<Glyph> glyphs;
+        std::vector<Line> lines;
+        int height = 0;
+        bool shaped = false;
+    };
+
+    Paragraph make_paragraph(std::string_view text) const;
+    void shape(std::size_t paragraph);
+    void unshape(std::size_t paragraph);
+    int estimate_height(std::string_view text) const noexcept;
+    int advance(std::uint32_t glyph);
+    std::string_view line_text(Paragraph const& paragraph, Line const& line) const noexcept;
+    template <typename Lines>
+    void collect_lines(Rect const& area, Lines& lines);
+
+    void rebuild_heights() noexcept;
+    void add_height(std::size_t paragraph, int delta) noexcept;
+    int get_top(std::size_t paragraph) const noexcept;
+    std::size_t find_paragraph(int y) const noexcept;
+
+    observer_ptr<const Font> m_font;
+    int m_wrap_width;
+    int m_line_skip = 0;
+    int m_average_advance = 0;
+    std::vector<Paragraph> m_paragraphs;
+    std::vector<int> m_heights;
+    int m_total_height = 0;
+    std::unordered_map<std::uint32_t, int> m_advances;
+    std::vector<TextLine> m_visible;
+    TextLayoutStats m_stats;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/TextLayout.inl"
+#endif
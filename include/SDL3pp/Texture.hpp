@@ -0,0 +1,120 @@
+#ifndef SDL3PP_TEXTURE_HPP
+#define SDL3PP_TEXTURE_HPP
+
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <SDL3/SDL_render.h>
+#include <SDL3pp/Rect.hpp>
+#include <SDL3pp/Renderer.hpp>
+#include <SDL3pp/Surface.hpp>
+#include <SDL3pp/unique_handle.hpp>
+
+namespace SDL3pp
+{
+
+using TextureAccess = SDL_TextureAccess;
+
+/**
+ * @brief Driver-specific representation of pixel data
+ *
+ * @see https://wiki.libsdl.org/SDL3/SDL_Texture
+ */
+class Texture
+{
+public:
+    Texture() = delete;
+
+    /**
+     * @brief Construct a new Texture object
+     *
+     * @param renderer the rendering context.
+     * @param format the pixel format of the texture.
+     * @param access one of SDL_TEXTUREACCESS_STATIC, SDL_TEXTUREACCESS_STREAMING
+     *               or SDL_TEXTUREACCESS_TARGET.
+     * @param w the width of the texture in pixels.
+     * @param h the height of the texture in pixels.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     *
+     * @threadsafety This function should only be called on the main thread.
+     */
+    Texture(Renderer& renderer, PixelFormat format, TextureAccess access, int w, int h);
+
+    /**
+     * @brief Construct a new Texture object from an existing surface
+     *
+     * The surface is not modified and can be destroyed afterwards.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     *
+     * @threadsafety This function should only be called on the main thread.
+     */
+    Texture(Renderer& renderer, Surface const& surface);
+
+    /**
+     * @brief Take the ownership of an existing SDL_Texture
+     *
+     * @param texture the texture to own, it is destroyed with the object.
+     */
+    inline Texture(SDL_Texture* texture);
+
+    Texture(Texture const&) = delete;
+    Texture& operator=(Texture const&) = delete;
+
+    Texture(Texture&&) = default;
+    Texture& operator=(Texture&&) = default;
+
+    ~Texture() = default;
+
+    inline int get_width() const noexcept;
+
+    inline int get_height() const noexcept;
+
+    inline std::pair<int, int> get_size() const noexcept;
+
+    inline PixelFormat get_format() const noexcept;
+
+    /**
+     * @brief Set the blend mode used for texture copy operations
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     */
+    inline void set_blend_mode(BlendMode mode);
+
+    /**
+     * @brief Update the given texture rectangle with new pixel data
+     *
+     * @param rect the area to update, or std::nullopt to update the whole
+     *             texture.
+     * @param pixels the raw pixel data in the format of the texture.
+     * @param pitch the number of bytes in a row of pixel data.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     *
+     * @threadsafety This function should only be called on the main thread.
+     */
+    inline void update(std::optional<Rect> const& rect, const void* pixels, int pitch);
+
+    /**
+     * @brief Get the underlying SDL_Texture
+     *
+     * The ownership is kept by the Texture object.
+     */
+    inline SDL_Texture* get() const noexcept;
+
+private:
+    unique_handle<SDL_Texture, &SDL_DestroyTexture> m_texture;
+};
+
+// A single handle, relocated by a std::memcpy
+template <>
+struct is_trivially_relocatable<Texture> : std::true_type
+{
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/Texture.inl"
+#endif
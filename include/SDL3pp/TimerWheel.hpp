@@ -0,0 +1,251 @@
+#ifndef SDL3PP_TIMER_WHEEL_HPP
+#define SDL3PP_TIMER_WHEEL_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_timer.h>
+#include <SDL3pp/SmallFunction.hpp>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Identifier of a timer of a TimerWheel
+ *
+ * A handle outlives its timer: once the timer is expired or cancelled,
+ * functions receiving the handle do nothing.
+ */
+struct TimerHandle
+{
+    std::uint32_t index;
+    std::uint32_t generation;
+};
+
+/**
+ * @brief Counters of a TimerWheel
+ *
+ * The counters are accumulated until TimerWheel::reset_stats() is called.
+ */
+struct TimerWheelStats
+{
+    /** Number of timers added. */
+    std::size_t added_timers = 0;
+    /** Number of timers cancelled before expiring. */
+    std::size_t cancelled_timers = 0;
+    /** Number of callbacks run, periodic timers counting once per period. */
+    std::size_t expired_timers = 0;
+    /** Number of timers moved down a level of the wheel. */
+    std::size_t cascaded_timers = 0;
+};
+
+/**
+ * @brief Hierarchical hashed timer wheel running its callbacks on the main thread
+ *
+ * The timers are kept in 4 wheels of 256 slots, each slot of a level
+ * spanning a whole turn of the level below, so that the wheels cover 2^32
+ * milliseconds. A timer is linked into the slot of its deadline at the
+ * lowest level able to hold it: adding and cancelling are O(1), whatever
+ * the number of timers. When the lowest wheel completes a turn, the next
+ * slot of the level above is cascaded down, each of its timers going one
+ * level closer to expiry.
+ *
+ * The wheel is advanced by advance() or update(), usually once per frame
+ * from the main loop, and the timers expired by a call run their
+ * callbacks as one batch, in the order of their deadlines. The slots
+ * without timers are skipped, so a long pause costs no more than a turn
+ * per 256 milliseconds. Alternatively, set_sdl_timer() lets one SDL timer
+ * ask SDL_RunOnMainThread() to update the wheel, instead of registering
+ * every timer with SDL_AddTimer().
+ *
+ * The callbacks may add and cancel timers, including themselves.
+ *
+ * @code {.cpp}
+ * SDL3pp::TimerWheel timers;
+ * timers.add(1500, [&] { door.close(); });
+ * SDL3pp::TimerHandle blink = timers.add(250, [&] { cursor.toggle(); }, 250);
+ *
+ * // main loop, each frame
+ * timers.update();
+ * @endcode
+ *
+ * @see https://wiki.libsdl.org/SDL3/SDL_AddTimer
+ */
+class TimerWheel
+{
+public:
+    using Callback = SmallFunction<void()>;
+
+    /**
+     * @brief Construct a new TimerWheel object starting at the current time
+     *
+     * @param capacity the number of timers allocated ahead, more are
+     *                 allocated when needed.
+     */
+    explicit TimerWheel(std::size_t capacity = 1024);
+
+    /**
+     * @brief Construct a new TimerWheel object starting at a given time
+     *
+     * @param capacity the number of timers allocated ahead, more are
+     *                 allocated when needed.
+     * @param ticks the current time, in milliseconds.
+     */
+    TimerWheel(std::size_t capacity, Uint64 ticks);
+
+    TimerWheel(TimerWheel const&) = delete;
+    TimerWheel& operator=(TimerWheel const&) = delete;
+
+    // The SDL timer keeps the address of the object
+    TimerWheel(TimerWheel&&) = delete;
+    TimerWheel& operator=(TimerWheel&&) = delete;
+
+    /**
+     * @brief Destroy the wheel, dropping the pending timers
+     *
+     * A pending SDL dispatch keeps the address of the wheel: destroy it
+     * after SDL_Quit(), or once is_dispatch_pending() is false.
+     */
+    ~TimerWheel();
+
+    /**
+     * @brief Add a timer
+     *
+     * @param delay the time before the first expiry, in milliseconds. A
+     *              timer of delay 0 expires at the next advance of time.
+     * @param callback the function run when the timer expires, which must
+     *                 not throw.
+     * @param interval the period of the timer after the first expiry, in
+     *                 milliseconds, 0 for a one-shot timer.
+     * @returns the handle of the timer.
+     *
+     * @threadsafety This function should only be called by the main thread.
+     */
+    template <typename F>
+    TimerHandle add(Uint64 delay, F&& callback, Uint64 interval = 0);
+
+    /**
+     * @brief Cancel a timer
+     *
+     * @param timer the timer.
+     * @returns false if the timer was already expired or cancelled.
+     *
+     * @threadsafety This function should only be called by the main thread.
+     */
+    bool cancel(TimerHandle timer) noexcept;
+
+    /**
+     * @brief Check whether a timer will expire
+     */
+    inline bool is_pending(TimerHandle timer) const noexcept;
+
+    /**
+     * @brief Advance the wheel to SDL_GetTicks()
+     *
+     * @returns the number of callbacks run.
+     *
+     * @threadsafety This function should only be called by the main thread.
+     */
+    std::size_t update();
+
+    /**
+     * @brief Advance the wheel to a given time and run the expired callbacks
+     *
+     * @param ticks the time, in milliseconds, such as the time of the frame.
+     *              Going backward does nothing.
+     * @returns the number of callbacks run.
+     *
+     * @threadsafety This function should only be called by the main thread.
+     */
+    std::size_t advance(Uint64 ticks);
+
+    /**
+     * @brief Drive the wheel with one SDL timer
+     *
+     * Each time the SDL timer fires, it asks SDL_RunOnMainThread() to call
+     * update(), at most one request being pending at a time.
+     *
+     * @param interval the period of the SDL timer, in milliseconds, 0 to
+     *                 remove it.
+     *
+     * @exception SDL3pp::Exception call exception.what() for more information about this
+     *
+     * @threadsafety This function should only be called by the main thread.
+     */
+    void set_sdl_timer(Uint32 interval);
+
+    inline bool is_dispatch_pending() const noexcept;
+
+    /**
+     * @brief Get the time the wheel was advanced to, in milliseconds
+     */
+    inline Uint64 get_ticks() const noexcept;
+
+    /**
+     * @brief Get the number of pending timers
+     */
+    inline std::size_t get_size() const noexcept;
+
+    TimerWheelStats get_stats() const noexcept;
+
+    void reset_stats() noexcept;
+
+private:
+    static constexpr std::size_t level_count = 4;
+    static constexpr unsigned slot_bits = 8;
+    static constexpr std::size_t slot_count = std::size_t {1} << slot_bits;
+    static constexpr std::uint32_t no_timer = UINT32_MAX;
+
+    struct Timer
+    {
+        Callback callback;
+        Uint64 deadline = 0;
+        Uint64 interval = 0;
+        std::uint32_t previous = no_timer;
+        std::uint32_t next = no_timer;
+        // Index into m_slots of the list holding the timer, no_timer when
+        // it is not linked
+        std::uint32_t slot = no_timer;
+        std::uint32_t generation = 0;
+        bool pending = false;
+    };
+
+    TimerHandle insert(Callback&& callback, Uint64 delay, Uint64 interval);
+    void schedule(std::uint32_t index) noexcept;
+    void link(std::uint32_t index, std::uint32_t slot) noexcept;
+    void unlink(std::uint32_t index) noexcept;
+    void release(std::uint32_t index) noexcept;
+    void cascade(std::size_t level) noexcept;
+    void collect(std::uint32_t slot);
+    Uint64 find_next_tick(Uint64 ticks) const noexcept;
+    static Uint32 SDLCALL on_sdl_timer(void* userdata, SDL_TimerID id, Uint32 interval);
+    static void SDLCALL on_dispatch(void* userdata);
+
+    std::vector<Timer> m_timers;
+    // Timers free for reuse, linked through Timer::next
+    std::uint32_t m_free = no_timer;
+    std::size_t m_size = 0;
+
+    // Heads of the slot lists, level by level
+    std::array<std::uint32_t, level_count * slot_count> m_slots;
+    // Non-empty slots of the lowest level, to skip the empty ones
+    std::array<std::uint64_t, slot_count / 64> m_occupied {};
+    Uint64 m_ticks;
+
+    // Expired timers of the current advance, as index and generation
+    std::vector<TimerHandle> m_expired;
+
+    TimerWheelStats m_stats;
+
+    SDL_TimerID m_sdl_timer = 0;
+    std::atomic<bool> m_dispatch_pending {false};
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/TimerWheel.inl"
+#endif
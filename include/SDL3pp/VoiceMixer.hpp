@@ -0,0 +1,193 @@
+#ifndef SDL3PP_VOICE_MIXER_HPP
+#define SDL3PP_VOICE_MIXER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <SDL3pp/AudioStream.hpp>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Identifier of a voice of a VoiceMixer
+ *
+ * A handle outlives its voice: once the voice is finished, functions
+ * receiving the handle do nothing.
+ */
+struct VoiceHandle
+{
+    std::uint32_t index;
+    std::uint32_t generation;
+};
+
+/**
+ * @brief Counters of a VoiceMixer
+ *
+ * The counters are accumulated until VoiceMixer::reset_stats() is called.
+ */
+struct VoiceMixerStats
+{
+    /** Number of voices started. */
+    std::size_t started_voices = 0;
+    /** Number of play() calls rejected because every voice was busy. */
+    std::size_t rejected_voices = 0;
+    /** Number of voice frames mixed, summed over the voices. */
+    std::size_t mixed_voice_frames = 0;
+};
+
+/**
+ * @brief Software mixer of mono float32 sounds into a stereo output
+ *
+ * The voices live in a pool allocated once at construction: play() takes
+ * a free voice in O(1) and never allocates, and a full pool rejects the
+ * new voice. Each voice has a gain and a constant-power pan which can be
+ * ramped linearly over a number of frames to avoid clicks.
+ *
+ * A voice is mixed by runs of frames where its source and its ramp are
+ * continuous. Each run is mixed with SSE or NEON when available, 4 frames
+ * at a time, the per-frame left and right gains being advanced by one
+ * vector addition.
+ *
+ * The sounds are not copied: their samples must stay alive while a voice
+ * plays them. The mixer is not thread-safe, it is meant to be driven by
+ * the thread producing the audio, usually into an AudioStream.
+ *
+ * @code {.cpp}
+ * SDL3pp::VoiceMixer mixer(256);
+ * mixer.play(explosion_samples, 0.8f, -0.5f);
+ *
+ * // game thread, each frame
+ * mixer.mix(stream);
+ * @endcode
+ */
+class VoiceMixer
+{
+public:
+    VoiceMixer() = delete;
+
+    /**
+     * @brief Construct a new VoiceMixer object
+     *
+     * @param capacity the number of voices which can play at once.
+     * @param block_frames the number of frames mixed per block by
+     *                     mix(AudioStream&).
+     */
+    explicit VoiceMixer(std::size_t capacity, std::size_t block_frames = 1024);
+
+    VoiceMixer(VoiceMixer const&) = delete;
+    VoiceMixer& operator=(VoiceMixer const&) = delete;
+
+    VoiceMixer(VoiceMixer&&) = default;
+    VoiceMixer& operator=(VoiceMixer&&) = default;
+
+    ~VoiceMixer() = default;
+
+    /**
+     * @brief Start a voice
+     *
+     * @param samples the mono samples of the sound.
+     * @param gain the gain of the voice.
+     * @param pan the pan of the voice, from -1 (left) to 1 (right).
+     * @param loop true to loop the sound until the voice is stopped.
+     * @returns the handle of the voice, or std::nullopt if every voice is
+     *          busy.
+     */
+    std::optional<VoiceHandle> play(std::span<const float> samples, float gain = 1.f, float pan = 0.f,
+                                    bool loop = false) noexcept;
+
+    /**
+     * @brief Stop a voice
+     *
+     * @param voice the voice to stop.
+     * @param fade_frames the length of the fade out, 0 to stop at once.
+     */
+    void stop(VoiceHandle voice, std::uint32_t fade_frames = 0) noexcept;
+
+    /**
+     * @brief Stop every voice at once
+     */
+    void stop_all() noexcept;
+
+    /**
+     * @brief Change the gain of a voice
+     *
+     * @param voice the voice.
+     * @param gain the new gain.
+     * @param ramp_frames the number of frames to reach the new gain.
+     */
+    void set_gain(VoiceHandle voice, float gain, std::uint32_t ramp_frames = 0) noexcept;
+
+    /**
+     * @brief Change the pan of a voice
+     *
+     * @param voice the voice.
+     * @param pan the new pan, from -1 (left) to 1 (right).
+     * @param ramp_frames the number of frames to reach the new pan.
+     */
+    void set_pan(VoiceHandle voice, float pan, std::uint32_t ramp_frames = 0) noexcept;
+
+    bool is_playing(VoiceHandle voice) const noexcept;
+
+    /**
+     * @brief Mix the playing voices
+     *
+     * @param output the interleaved stereo frames, overwritten with the mix.
+     */
+    void mix(std::span<float> output) noexcept;
+
+    /**
+     * @brief Mix blocks into an audio stream until its ring is full
+     *
+     * @param stream a stereo stream.
+     * @returns the number of frames written.
+     */
+    std::size_t mix(AudioStream& stream) noexcept;
+
+    inline std::size_t get_capacity() const noexcept;
+
+    inline std::size_t get_active_count() const noexcept;
+
+    inline VoiceMixerStats const& get_stats() const noexcept;
+
+    inline void reset_stats() noexcept;
+
+private:
+    struct Voice
+    {
+        const float* samples = nullptr;
+        std::size_t length = 0;
+        std::size_t position = 0;
+        bool loop = false;
+        bool playing = false;
+        bool stopping = false;
+        float gain = 0.f;
+        float pan = 0.f;
+        float left = 0.f;
+        float right = 0.f;
+        float left_step = 0.f;
+        float right_step = 0.f;
+        std::uint32_t ramp_frames = 0;
+        std::uint32_t generation = 0;
+        std::uint32_t active_slot = 0;
+    };
+
+    Voice* find(VoiceHandle voice) noexcept;
+    void ramp_to(Voice& voice, std::uint32_t frames) noexcept;
+    bool mix_voice(Voice& voice, float* output, std::size_t frames) noexcept;
+    void release(std::uint32_t index) noexcept;
+
+    std::vector<Voice> m_voices;
+    std::vector<std::uint32_t> m_free;
+    std::vector<std::uint32_t> m_active;
+    std::vector<float> m_block;
+    VoiceMixerStats m_stats;
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/VoiceMixer.inl"
+#endif
@@ -4,12 +4,13 @@
 #include <utility>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 
 #include <SDL3/SDL_video.h>
-#include <SDL3pp/movable_ptr.hpp>
 #include <SDL3pp/observer_ptr.hpp>
 #include <SDL3pp/Point.hpp>
+#include <SDL3pp/unique_handle.hpp>
 
 namespace SDL3pp
 {
@@ -137,7 +138,7 @@ public:
     Window(Window&&) = default;
     Window& operator=(Window&&);
 
-    virtual ~Window();
+    ~Window() = default;
 
     inline std::pair<int, int> get_size() const;
 
@@ -161,11 +162,25 @@ public:
 
     inline Point get_position() const;
 
+    /**
+     * @brief Get the underlying SDL_Window
+     *
+     * The ownership is kept by the Window object.
+     */
+    inline SDL_Window* get() const noexcept;
+
 private:
-    movable_ptr<SDL_Window> m_window;
+    unique_handle<SDL_Window, &SDL_DestroyWindow> m_window;
     observer_ptr<Window> m_parent_window;
 };
 
+// Window is not polymorphic: the handle and the parent pointer are all of
+// it, and are relocated by a std::memcpy
+template <>
+struct is_trivially_relocatable<Window> : std::true_type
+{
+};
+
 } // namespace SDL3pp
 
 #include "inline_src/Window.inl"
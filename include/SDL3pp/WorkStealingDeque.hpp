@@ -0,0 +1,101 @@
+#ifndef SDL3PP_WORK_STEALING_DEQUE_HPP
+#define SDL3PP_WORK_STEALING_DEQUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Lock-free Chase–Lev work-stealing deque
+ *
+ * The owner thread pushes and pops items at the bottom, like a stack, so
+ * it keeps working on the most recent and cache-hot items. Any other
+ * thread can steal the oldest item from the top. The owner only contends
+ * with thieves for the last item, through one compare-and-swap.
+ *
+ * The capacity is fixed and rounded up to a power of two: push() fails
+ * instead of growing, which lets the buffer be reused without the
+ * reclamation problem of a growable deque.
+ *
+ * @tparam T the type of the items, which must be trivially copyable.
+ *
+ * @see https://doi.org/10.1145/2442516.2442524
+ */
+template <typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable_v<T>, "WorkStealingDeque items must be trivially copyable");
+
+public:
+    WorkStealingDeque() = delete;
+
+    /**
+     * @brief Construct a new WorkStealingDeque object
+     *
+     * @param capacity the minimum number of items the deque can hold.
+     */
+    explicit WorkStealingDeque(std::size_t capacity);
+
+    WorkStealingDeque(WorkStealingDeque const&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque const&) = delete;
+
+    WorkStealingDeque(WorkStealingDeque&&) = delete;
+    WorkStealingDeque& operator=(WorkStealingDeque&&) = delete;
+
+    ~WorkStealingDeque() = default;
+
+    /**
+     * @brief Push an item at the bottom
+     *
+     * @param item the item to push.
+     * @returns false if the deque is full.
+     *
+     * @threadsafety This function should only be called by the owner.
+     */
+    bool push(T item) noexcept;
+
+    /**
+     * @brief Pop the most recent item from the bottom
+     *
+     * @threadsafety This function should only be called by the owner.
+     */
+    std::optional<T> pop() noexcept;
+
+    /**
+     * @brief Steal the oldest item from the top
+     *
+     * Fails when the deque is empty or when another thread took the item
+     * first.
+     *
+     * @threadsafety It is safe to call this function from any thread.
+     */
+    std::optional<T> steal() noexcept;
+
+    /**
+     * @brief Get an estimate of the number of items
+     */
+    inline std::size_t get_size() const noexcept;
+
+    inline std::size_t get_capacity() const noexcept;
+
+private:
+    // Separate the ends to avoid false sharing between the owner and thieves
+    static constexpr std::size_t cache_line_size = 64;
+
+    std::unique_ptr<std::atomic<T>[]> m_items;
+    std::int64_t m_mask;
+
+    alignas(cache_line_size) std::atomic<std::int64_t> m_top {0};
+    alignas(cache_line_size) std::atomic<std::int64_t> m_bottom {0};
+};
+
+} // namespace SDL3pp
+
+#include "inline_src/WorkStealingDeque.inl"
+#endif
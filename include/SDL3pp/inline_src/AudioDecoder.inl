@@ -0,0 +1,22 @@
+#include <cstddef>
+#include <SDL3pp/AudioDecoder.hpp>
+
+namespace SDL3pp
+{
+
+inline int WavDecoder::get_channels() const noexcept
+{
+    return m_channels;
+}
+
+inline int WavDecoder::get_frequency() const noexcept
+{
+    return m_frequency;
+}
+
+inline std::size_t WavDecoder::get_length() const noexcept
+{
+    return m_length;
+}
+
+}
@@ -0,0 +1,61 @@
+#include <cstddef>
+#include <SDL3/SDL_audio.h>
+#include <SDL3pp/AudioStream.hpp>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/Exception.hpp>
+
+namespace SDL3pp
+{
+
+inline std::size_t AudioStream::get_writable_frames() const noexcept
+{
+    return m_ring.get_free() / static_cast<std::size_t>(m_channels);
+}
+
+inline std::size_t AudioStream::get_buffered_frames() const noexcept
+{
+    return m_ring.get_size() / static_cast<std::size_t>(m_channels);
+}
+
+inline void AudioStream::pause()
+{
+    if (!SDL3PP_CALL(SDL_PauseAudioStreamDevice, get()))
+    {
+        throw Exception("SDL_PauseAudioStreamDevice");
+    }
+}
+
+inline void AudioStream::resume()
+{
+    if (!SDL3PP_CALL(SDL_ResumeAudioStreamDevice, get()))
+    {
+        throw Exception("SDL_ResumeAudioStreamDevice");
+    }
+}
+
+inline bool AudioStream::is_paused() const noexcept
+{
+    return SDL3PP_CALL(SDL_AudioStreamDevicePaused, get());
+}
+
+inline int AudioStream::get_channels() const noexcept
+{
+    return m_channels;
+}
+
+inline int AudioStream::get_frequency() const noexcept
+{
+    return m_frequency;
+}
+
+inline std::size_t AudioStream::get_capacity() const noexcept
+{
+    return m_ring.get_capacity() / static_cast<std::size_t>(m_channels);
+}
+
+inline SDL_AudioStream* AudioStream::get() const noexcept
+{
+    return m_stream.get();
+}
+
+}
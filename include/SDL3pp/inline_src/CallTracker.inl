@@ -0,0 +1,17 @@
+#include <SDL3/SDL_timer.h>
+#include <SDL3pp/CallTracker.hpp>
+
+namespace SDL3pp
+{
+
+inline CallTimer::CallTimer(CallSite& site) noexcept
+ : m_site(site),
+   m_start(SDL_GetPerformanceCounter())
+{}
+
+inline CallTimer::~CallTimer()
+{
+    CallTracker::record(m_site, m_start, SDL_GetPerformanceCounter());
+}
+
+}
@@ -0,0 +1,96 @@
+#include <cmath>
+#include <SDL3pp/Camera2D.hpp>
+
+namespace SDL3pp
+{
+
+inline Rect const& Camera2D::get_viewport() const noexcept
+{
+    return m_viewport;
+}
+
+inline void Camera2D::set_viewport(Rect const& viewport) noexcept
+{
+    m_viewport = viewport;
+}
+
+inline float Camera2D::get_zoom() const noexcept
+{
+    return m_zoom;
+}
+
+inline void Camera2D::set_zoom(float zoom) noexcept
+{
+    m_zoom = zoom;
+}
+
+inline Point const& Camera2D::get_offset() const noexcept
+{
+    return m_offset;
+}
+
+inline void Camera2D::set_offset(Point const& offset) noexcept
+{
+    m_offset = offset;
+}
+
+inline void Camera2D::move_by(Point const& delta) noexcept
+{
+    m_viewport += delta;
+}
+
+inline void Camera2D::center_on(Point const& position) noexcept
+{
+    m_viewport = Rect::from_center(position, m_viewport.get_size());
+}
+
+inline Rect Camera2D::get_screen_rect() const noexcept
+{
+    return world_to_screen(m_viewport);
+}
+
+inline bool Camera2D::is_visible(Point const& point) const noexcept
+{
+    return m_viewport.countains(point);
+}
+
+inline bool Camera2D::is_visible(Rect const& rect) const noexcept
+{
+    return m_viewport.intersects(rect);
+}
+
+inline int Camera2D::to_screen_x(int x) const noexcept
+{
+    return m_offset.get_x()
+         + static_cast<int>(std::floor(static_cast<float>(x - m_viewport.get_x()) * m_zoom));
+}
+
+inline int Camera2D::to_screen_y(int y) const noexcept
+{
+    return m_offset.get_y()
+         + static_cast<int>(std::floor(static_cast<float>(y - m_viewport.get_y()) * m_zoom));
+}
+
+inline Point Camera2D::world_to_screen(Point const& point) const noexcept
+{
+    return Point(to_screen_x(point.get_x()), to_screen_y(point.get_y()));
+}
+
+inline Rect Camera2D::world_to_screen(Rect const& rect) const noexcept
+{
+    const int x = to_screen_x(rect.get_x());
+    const int y = to_screen_y(rect.get_y());
+    return Rect(x, y,
+                to_screen_x(rect.get_x() + rect.get_width()) - x,
+                to_screen_y(rect.get_y() + rect.get_height()) - y);
+}
+
+inline Point Camera2D::screen_to_world(Point const& point) const noexcept
+{
+    return Point(m_viewport.get_x()
+                   + static_cast<int>(std::floor(static_cast<float>(point.get_x() - m_offset.get_x()) / m_zoom)),
+                 m_viewport.get_y()
+                   + static_cast<int>(std::floor(static_cast<float>(point.get_y() - m_offset.get_y()) / m_zoom)));
+}
+
+}
@@ -0,0 +1,14 @@
+#include <cstddef>
+#include <SDL3pp/CoroutineFramePool.hpp>
+
+namespace SDL3pp
+{
+
+inline constexpr std::size_t CoroutineFramePool::get_size_class(std::size_t size) noexcept
+{
+    // 1 to granularity bytes map to class 0, and so on; the classes from
+    // class_count up bypass the pool
+    return size == 0 ? 0 : (size - 1) / granularity;
+}
+
+}
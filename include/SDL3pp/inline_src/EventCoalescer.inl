@@ -0,0 +1,26 @@
+#include <SDL3pp/EventCoalescer.hpp>
+
+namespace SDL3pp
+{
+
+inline void EventCoalescer::set_config(EventCoalescerConfig const& config) noexcept
+{
+    m_config = config;
+}
+
+inline EventCoalescerConfig const& EventCoalescer::get_config() const noexcept
+{
+    return m_config;
+}
+
+inline EventCoalescerStats const& EventCoalescer::get_stats() const noexcept
+{
+    return m_stats;
+}
+
+inline std::size_t EventCoalescer::get_dropped_events() const noexcept
+{
+    return m_stats.dropped_motion_events + m_stats.dropped_wheel_events;
+}
+
+}
@@ -0,0 +1,36 @@
+#include <SDL3pp/EventLog.hpp>
+
+namespace SDL3pp
+{
+
+inline bool EventRecorder::is_recording() const noexcept
+{
+    return m_recording;
+}
+
+inline bool EventPlayer::is_finished() const noexcept
+{
+    return m_cursor >= m_end;
+}
+
+inline PlaybackMode EventPlayer::get_mode() const noexcept
+{
+    return m_mode;
+}
+
+inline std::size_t EventPlayer::get_event_count() const noexcept
+{
+    return m_event_count;
+}
+
+inline Uint64 EventPlayer::get_duration_ns() const noexcept
+{
+    return m_duration_ns;
+}
+
+inline EventPlayerStats const& EventPlayer::get_stats() const noexcept
+{
+    return m_stats;
+}
+
+}
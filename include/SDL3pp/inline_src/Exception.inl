@@ -4,7 +4,7 @@
 
 namespace SDL3pp {
 
-std::string Exception::make_what(std::string const& function, std::string const& sdl_error) {
+inline std::string Exception::make_what(std::string const& function, std::string const& sdl_error) {
     using namespace std::literals;
     return function + " failed: " + sdl_error;
 }
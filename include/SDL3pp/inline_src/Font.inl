@@ -0,0 +1,72 @@
+#include <cstdint>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/Font.hpp>
+
+namespace SDL3pp
+{
+
+inline Font::Font(TTF_Font* font)
+ : m_font(font), m_id(next_id())
+{}
+
+inline std::uint32_t Font::get_id() const noexcept
+{
+    return m_id;
+}
+
+inline float Font::get_size() const noexcept
+{
+    return SDL3PP_CALL(TTF_GetFontSize, get());
+}
+
+inline void Font::set_size(float size)
+{
+    if (!SDL3PP_CALL(TTF_SetFontSize, get(), size))
+    {
+        throw Exception("TTF_SetFontSize");
+    }
+}
+
+inline FontStyle Font::get_style() const noexcept
+{
+    return SDL3PP_CALL(TTF_GetFontStyle, get());
+}
+
+inline void Font::set_style(FontStyle style) noexcept
+{
+    SDL3PP_CALL(TTF_SetFontStyle, get(), style);
+}
+
+inline int Font::get_height() const noexcept
+{
+    return SDL3PP_CALL(TTF_GetFontHeight, get());
+}
+
+inline int Font::get_ascent() const noexcept
+{
+    return SDL3PP_CALL(TTF_GetFontAscent, get());
+}
+
+inline int Font::get_descent() const noexcept
+{
+    return SDL3PP_CALL(TTF_GetFontDescent, get());
+}
+
+inline int Font::get_line_skip() const noexcept
+{
+    return SDL3PP_CALL(TTF_GetFontLineSkip, get());
+}
+
+inline bool Font::has_glyph(std::uint32_t glyph) const noexcept
+{
+    return SDL3PP_CALL(TTF_FontHasGlyph, get(), glyph);
+}
+
+inline TTF_Font* Font::get() const noexcept
+{
+    return m_font.get();
+}
+
+}
@@ -0,0 +1,23 @@
+#include <cstddef>
+#include <memory_resource>
+#include <SDL3pp/FrameArena.hpp>
+
+namespace SDL3pp
+{
+
+inline std::size_t FrameArena::get_used() const noexcept
+{
+    return m_buffers[m_current].used;
+}
+
+inline std::size_t FrameArena::get_capacity() const noexcept
+{
+    return m_buffers[m_current].capacity;
+}
+
+inline std::pmr::memory_resource* FrameArena::get_upstream() const noexcept
+{
+    return m_upstream;
+}
+
+}
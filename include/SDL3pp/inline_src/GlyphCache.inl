@@ -0,0 +1,37 @@
+#include <cstddef>
+#include <SDL3pp/GlyphCache.hpp>
+
+namespace SDL3pp
+{
+
+inline void GlyphCache::next_frame() noexcept
+{
+    ++m_frame;
+}
+
+inline Texture const& GlyphCache::get_page(std::size_t page) const noexcept
+{
+    return m_pages[page].texture;
+}
+
+inline std::size_t GlyphCache::get_page_count() const noexcept
+{
+    return m_pages.size();
+}
+
+inline std::size_t GlyphCache::get_size() const noexcept
+{
+    return m_glyphs.size();
+}
+
+inline GlyphCacheStats const& GlyphCache::get_stats() const noexcept
+{
+    return m_stats;
+}
+
+inline void GlyphCache::reset_stats() noexcept
+{
+    m_stats = GlyphCacheStats();
+}
+
+}
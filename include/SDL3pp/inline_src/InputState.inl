@@ -0,0 +1,104 @@
+#include <bit>
+#include <SDL3pp/InputState.hpp>
+
+namespace SDL3pp
+{
+
+constexpr bool KeyMask::test(SDL_Scancode key) const noexcept
+{
+    const auto index = static_cast<std::size_t>(key);
+    if (index >= key_count)
+        return false;
+    return (words[index / 64] >> (index % 64) & 1) != 0;
+}
+
+constexpr bool KeyMask::any() const noexcept
+{
+    for (const std::uint64_t word : words)
+    {
+        if (word != 0)
+            return true;
+    }
+    return false;
+}
+
+constexpr std::size_t KeyMask::count() const noexcept
+{
+    std::size_t keys = 0;
+    for (const std::uint64_t word : words)
+        keys += static_cast<std::size_t>(std::popcount(word));
+    return keys;
+}
+
+inline bool InputState::is_key_down(SDL_Scancode key) const noexcept
+{
+    const auto index = static_cast<std::size_t>(key);
+    return index < m_keyboard.size() && m_keyboard[index];
+}
+
+inline bool InputState::is_key_pressed(SDL_Scancode key) const noexcept
+{
+    return m_pressed.test(key);
+}
+
+inline bool InputState::is_key_released(SDL_Scancode key) const noexcept
+{
+    return m_released.test(key);
+}
+
+inline bool InputState::is_key_held(SDL_Scancode key) const noexcept
+{
+    return m_held.test(key);
+}
+
+inline KeyMask const& InputState::get_keys() const noexcept
+{
+    return m_keys;
+}
+
+inline KeyMask const& InputState::get_pressed_keys() const noexcept
+{
+    return m_pressed;
+}
+
+inline KeyMask const& InputState::get_released_keys() const noexcept
+{
+    return m_released;
+}
+
+inline KeyMask const& InputState::get_held_keys() const noexcept
+{
+    return m_held;
+}
+
+inline Point InputState::get_mouse_position() const noexcept
+{
+    return m_mouse_position;
+}
+
+inline Point InputState::get_mouse_motion() const noexcept
+{
+    return m_mouse_motion;
+}
+
+inline SDL_MouseButtonFlags InputState::get_mouse_buttons() const noexcept
+{
+    return m_buttons;
+}
+
+inline bool InputState::is_button_down(Uint8 button) const noexcept
+{
+    return (m_buttons & SDL_BUTTON_MASK(button)) != 0;
+}
+
+inline bool InputState::is_button_pressed(Uint8 button) const noexcept
+{
+    return (m_buttons & ~m_previous_buttons & SDL_BUTTON_MASK(button)) != 0;
+}
+
+inline bool InputState::is_button_released(Uint8 button) const noexcept
+{
+    return (~m_buttons & m_previous_buttons & SDL_BUTTON_MASK(button)) != 0;
+}
+
+}
@@ -0,0 +1,57 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <SDL3pp/JobSystem.hpp>
+
+namespace SDL3pp
+{
+
+inline bool JobSystem::Counter::is_done() const noexcept
+{
+    return m_pending.load(std::memory_order_acquire) == 0;
+}
+
+inline std::size_t JobSystem::Counter::get_pending() const noexcept
+{
+    return (m_pending.load(std::memory_order_acquire) + 1) / 2;
+}
+
+template <typename F>
+void JobSystem::parallel_for(std::size_t begin, std::size_t end, std::size_t grain, F&& function)
+{
+    if (begin >= end)
+        return;
+    if (grain == 0)
+        grain = std::max<std::size_t>((end - begin) / ((get_worker_count() + 1) * 4), 1);
+
+    using Function = std::remove_reference_t<F>;
+    const RangeFunction call = [](void* context, std::size_t first, std::size_t last) {
+        (*static_cast<Function*>(context))(first, last);
+    };
+    void* const context = const_cast<void*>(static_cast<const void*>(std::addressof(function)));
+
+    Counter counter;
+    const std::size_t first_end = std::min(end - begin, grain) + begin;
+    try
+    {
+        for (std::size_t first = first_end; first < end; first += std::min(end - first, grain))
+            submit_range(call, context, first, first + std::min(end - first, grain), counter);
+    }
+    catch (...)
+    {
+        // The chunks submitted use the counter and the function
+        wait(counter);
+        throw;
+    }
+    function(begin, first_end);
+    wait(counter);
+}
+
+inline std::size_t JobSystem::get_worker_count() const noexcept
+{
+    return m_workers.size();
+}
+
+}
@@ -0,0 +1,81 @@
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <type_traits>
+#include <utility>
+#include <SDL3/SDL_init.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/MainThreadQueue.hpp>
+
+namespace SDL3pp
+{
+
+template <typename F>
+void MainThreadQueue::post(F&& task)
+{
+    push(Task(std::forward<F>(task)));
+}
+
+template <typename F>
+bool MainThreadQueue::try_post(F&& task)
+{
+    Task wrapped(std::forward<F>(task));
+    if (!try_push(wrapped))
+        return false;
+    m_posted_tasks.fetch_add(1, std::memory_order_relaxed);
+    if (m_sdl_dispatch.load(std::memory_order_relaxed))
+        request_dispatch();
+    return true;
+}
+
+template <typename F>
+std::future<std::invoke_result_t<std::decay_t<F>&>> MainThreadQueue::invoke(F&& task)
+{
+    using Result = std::invoke_result_t<std::decay_t<F>&>;
+    std::promise<Result> promise;
+    std::future<Result> future = promise.get_future();
+    auto run = [promise = std::move(promise), task = std::forward<F>(task)]() mutable {
+        try
+        {
+            if constexpr (std::is_void_v<Result>)
+            {
+                task();
+                promise.set_value();
+            }
+            else
+            {
+                promise.set_value(task());
+            }
+        }
+        catch (...)
+        {
+            promise.set_exception(std::current_exception());
+        }
+    };
+
+    if (SDL3PP_CALL(SDL_IsMainThread))
+        run();
+    else
+        push(Task(std::move(run)));
+    return future;
+}
+
+inline bool MainThreadQueue::is_dispatch_pending() const noexcept
+{
+    return m_dispatch_pending.load(std::memory_order_acquire);
+}
+
+inline std::size_t MainThreadQueue::get_size() const noexcept
+{
+    const std::size_t head = m_head.load(std::memory_order_relaxed);
+    const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+    return tail > head ? tail - head : 0;
+}
+
+inline std::size_t MainThreadQueue::get_capacity() const noexcept
+{
+    return m_mask + 1;
+}
+
+}
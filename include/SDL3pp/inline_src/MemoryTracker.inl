@@ -0,0 +1,31 @@
+#include <SDL3pp/MemoryTracker.hpp>
+
+namespace SDL3pp
+{
+
+inline constexpr const char* get_memory_tag_name(MemoryTag tag) noexcept
+{
+    switch (tag)
+    {
+    case MemoryTag::general:
+        return "general";
+    case MemoryTag::video:
+        return "video";
+    case MemoryTag::render:
+        return "render";
+    case MemoryTag::surface:
+        return "surface";
+    case MemoryTag::audio:
+        return "audio";
+    case MemoryTag::text:
+        return "text";
+    case MemoryTag::io:
+        return "io";
+    case MemoryTag::count:
+    default:
+        break;
+    }
+    return "unknown";
+}
+
+}
@@ -0,0 +1,33 @@
+#include <atomic>
+#include <cstddef>
+#include <SDL3pp/MusicStream.hpp>
+
+namespace SDL3pp
+{
+
+inline bool MusicStream::is_ready() const noexcept
+{
+    return m_time_to_first_sample.load(std::memory_order_acquire) != 0 || m_end.load(std::memory_order_acquire);
+}
+
+inline bool MusicStream::is_finished() const noexcept
+{
+    return m_end.load(std::memory_order_acquire) && m_ring.get_size() == 0;
+}
+
+inline int MusicStream::get_channels() const noexcept
+{
+    return m_channels;
+}
+
+inline int MusicStream::get_frequency() const noexcept
+{
+    return m_frequency;
+}
+
+inline std::size_t MusicStream::get_buffered_frames() const noexcept
+{
+    return m_ring.get_size() / static_cast<std::size_t>(m_channels);
+}
+
+}
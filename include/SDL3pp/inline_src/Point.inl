@@ -189,4 +189,12 @@ constexpr bool
 operator!=(SDL3pp::Point const& a, SDL3pp::Point const& b) noexcept
 {
   return !(a == b);
-}
\ No newline at end of file
+}
+
+template<class CharT, class Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& stream, SDL3pp::Point const& point)
+{
+  stream << "[x:" << point.get_x() << ",y:" << point.get_y() << "]";
+  return stream;
+}
@@ -0,0 +1,17 @@
+#include <SDL3/SDL_timer.h>
+#include <SDL3pp/Profiler.hpp>
+
+namespace SDL3pp
+{
+
+inline ProfileZone::ProfileZone(const char* name) noexcept
+ : m_name(name),
+   m_start(SDL_GetPerformanceCounter())
+{}
+
+inline ProfileZone::~ProfileZone()
+{
+    Profiler::record(m_name, m_start, SDL_GetPerformanceCounter());
+}
+
+}
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <optional>
 #include <SDL3pp/Point.hpp>
 #include <SDL3pp/Rect.hpp>
 #include <utility>
@@ -66,7 +68,7 @@ Rect::get_x() const noexcept
 constexpr Rect&
 Rect::set_x(int nx) noexcept
 {
-  x = x;
+  x = nx;
   return *this;
 }
 
@@ -198,4 +200,145 @@ Rect::intersects(Rect const& rect) const noexcept
            rect.y > get_y2());
 }
 
-}
\ No newline at end of file
+constexpr Rect
+Rect::get_union(Rect const& rect) const
+{
+  return Rect::from_corners(std::min(x, rect.x),
+                            std::min(y, rect.y),
+                            std::max(get_x2(), rect.get_x2()),
+                            std::max(get_y2(), rect.get_y2()));
+}
+
+constexpr Rect&
+Rect::union_in_place(const Rect& rect)
+{
+  *this = get_union(rect);
+  return *this;
+}
+
+constexpr Rect
+Rect::get_extension(unsigned int amount) const
+{
+  Rect r = *this;
+  r.extend_in_place(amount);
+  return r;
+}
+
+constexpr Rect
+Rect::get_extension(unsigned int hamount, unsigned int vamount) const
+{
+  Rect r = *this;
+  r.extend_in_place(hamount, vamount);
+  return r;
+}
+
+constexpr Rect&
+Rect::extend_in_place(unsigned int amount)
+{
+  return extend_in_place(amount, amount);
+}
+
+constexpr Rect&
+Rect::extend_in_place(unsigned int hamount, unsigned int vamount)
+{
+  x -= static_cast<int>(hamount);
+  y -= static_cast<int>(vamount);
+  w += static_cast<int>(hamount * 2);
+  h += static_cast<int>(vamount * 2);
+  return *this;
+}
+
+constexpr std::optional<Rect>
+Rect::get_intersection(const Rect& rect) const
+{
+  if (!intersects(rect))
+    return std::nullopt;
+
+  return Rect::from_corners(std::max(x, rect.x),
+                            std::max(y, rect.y),
+                            std::min(get_x2(), rect.get_x2()),
+                            std::min(get_y2(), rect.get_y2()));
+}
+
+inline bool
+Rect::intersect_line(int& x1, int& y1, int& x2, int& y2) const
+{
+  return SDL_GetRectAndLineIntersection(this, &x1, &y1, &x2, &y2);
+}
+
+inline bool
+Rect::intersect_line(Point& p1, Point& p2) const
+{
+  int x1 = p1.get_x();
+  int y1 = p1.get_y();
+  int x2 = p2.get_x();
+  int y2 = p2.get_y();
+  const bool res = SDL_GetRectAndLineIntersection(this, &x1, &y1, &x2, &y2);
+  p1.set_x(x1);
+  p1.set_y(y1);
+  p2.set_x(x2);
+  p2.set_y(y2);
+  return res;
+}
+
+// Members of Point taking a Rect, which Point.inl sees incomplete
+
+constexpr Point
+Point::get_clamped(const Rect& rect) const
+{
+  Point p = *this;
+  p.clamp(rect);
+  return p;
+}
+
+constexpr Point&
+Point::clamp(const Rect& rect)
+{
+  if (x < rect.get_x())
+    x = rect.get_x();
+  if (x > rect.get_x2())
+    x = rect.get_x2();
+  if (y < rect.get_y())
+    y = rect.get_y();
+  if (y > rect.get_y2())
+    y = rect.get_y2();
+  return *this;
+}
+
+constexpr Point
+Point::get_wrapped(const Rect& rect) const
+{
+  Point p = *this;
+  p.wrap(rect);
+  return p;
+}
+
+constexpr Point&
+Point::wrap(const Rect& rect)
+{
+  if (x < rect.get_x())
+    x = rect.get_x() + rect.get_width() - 1
+      - (rect.get_x() - x + rect.get_width() - 1) % rect.get_width();
+  else if (x >= rect.get_x() + rect.get_width())
+    x = rect.get_x() + (x - rect.get_x() - rect.get_width()) % rect.get_width();
+
+  if (y < rect.get_y())
+    y = rect.get_y() + rect.get_height() - 1
+      - (rect.get_y() - y + rect.get_height() - 1) % rect.get_height();
+  else if (y >= rect.get_y() + rect.get_height())
+    y = rect.get_y() + (y - rect.get_y() - rect.get_height()) % rect.get_height();
+
+  return *this;
+}
+
+}
+
+template<class CharT, class Traits>
+std::basic_ostream<CharT, Traits>&
+operator<<(std::basic_ostream<CharT, Traits>& stream, const SDL3pp::Rect& rect)
+{
+  stream << "[x:" << rect.get_x() << ",y:" << rect.get_y()
+         << ",w:" << rect.get_width()
+         << ",h:" << rect.get_height() << "]";
+  return stream;
+}
@@ -0,0 +1,41 @@
+#include <cstddef>
+#include <memory_resource>
+#include <SDL3pp/RenderCommandList.hpp>
+
+namespace SDL3pp
+{
+
+inline RenderCommandList::RenderCommandList(allocator_type allocator) noexcept
+ : m_commands(allocator),
+   m_points(allocator),
+   m_rects(allocator),
+   m_geometries(allocator),
+   m_vertices(allocator),
+   m_indices(allocator),
+   m_textures(allocator),
+   m_scratch_points(allocator),
+   m_scratch_rects(allocator),
+   m_scratch_vertices(allocator)
+{}
+
+inline bool RenderCommandList::is_empty() const noexcept
+{
+    return m_commands.empty();
+}
+
+inline std::size_t RenderCommandList::get_size() const noexcept
+{
+    return m_commands.size();
+}
+
+inline Rect RenderCommandList::get_bounds() const noexcept
+{
+    return m_bounds;
+}
+
+inline RenderCommandList::allocator_type RenderCommandList::get_allocator() const noexcept
+{
+    return m_commands.get_allocator();
+}
+
+}
@@ -0,0 +1,73 @@
+#include <SDL3/SDL_render.h>
+#include <SDL3pp/Renderer.hpp>
+
+namespace SDL3pp
+{
+
+inline Renderer::Renderer(SDL_Renderer* renderer)
+ : m_renderer(renderer)
+{}
+
+inline void Renderer::set_draw_color(Color const& color)
+{
+    if (color.r == m_state.color.r && color.g == m_state.color.g
+        && color.b == m_state.color.b && color.a == m_state.color.a)
+        return;
+    flush();
+    m_state.color = color;
+}
+
+inline Color Renderer::get_draw_color() const noexcept
+{
+    return m_state.color;
+}
+
+inline void Renderer::set_draw_blend_mode(BlendMode mode)
+{
+    if (mode == m_state.blend_mode)
+        return;
+    flush();
+    m_state.blend_mode = mode;
+}
+
+inline BlendMode Renderer::get_draw_blend_mode() const noexcept
+{
+    return m_state.blend_mode;
+}
+
+inline SDL_Texture* Renderer::get_target() const noexcept
+{
+    return m_state.target;
+}
+
+inline bool Renderer::is_batching() const noexcept
+{
+    return m_batching;
+}
+
+inline void Renderer::end_recording() noexcept
+{
+    m_recording.reset();
+}
+
+inline bool Renderer::is_recording() const noexcept
+{
+    return static_cast<bool>(m_recording);
+}
+
+inline RenderStats const& Renderer::get_stats() const noexcept
+{
+    return m_stats;
+}
+
+inline void Renderer::reset_stats() noexcept
+{
+    m_stats = RenderStats();
+}
+
+inline SDL_Renderer* Renderer::get() const noexcept
+{
+    return m_renderer.get();
+}
+
+}
@@ -0,0 +1,147 @@
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <SDL3pp/SmallFunction.hpp>
+
+namespace SDL3pp
+{
+
+template <typename R, typename... Args, std::size_t Capacity>
+template <typename F>
+struct SmallFunction<R(Args...), Capacity>::InlineOperations
+{
+    static R invoke(void* storage, Args&&... args)
+    {
+        return std::invoke(*std::launder(static_cast<F*>(storage)), std::forward<Args>(args)...);
+    }
+
+    static void move(void* from, void* to) noexcept
+    {
+        F* const function = std::launder(static_cast<F*>(from));
+        ::new (to) F(std::move(*function));
+        function->~F();
+    }
+
+    static void destroy(void* storage) noexcept
+    {
+        std::launder(static_cast<F*>(storage))->~F();
+    }
+
+    static constexpr Operations operations {&invoke, &move, &destroy, true};
+};
+
+template <typename R, typename... Args, std::size_t Capacity>
+template <typename F>
+struct SmallFunction<R(Args...), Capacity>::HeapOperations
+{
+    // The storage holds a pointer to the callable
+    static F*& pointer(void* storage) noexcept
+    {
+        return *std::launder(static_cast<F**>(storage));
+    }
+
+    static R invoke(void* storage, Args&&... args)
+    {
+        return std::invoke(*pointer(storage), std::forward<Args>(args)...);
+    }
+
+    static void move(void* from, void* to) noexcept
+    {
+        ::new (to) F*(pointer(from));
+    }
+
+    static void destroy(void* storage) noexcept
+    {
+        delete pointer(storage);
+    }
+
+    static constexpr Operations operations {&invoke, &move, &destroy, false};
+};
+
+template <typename R, typename... Args, std::size_t Capacity>
+inline SmallFunction<R(Args...), Capacity>::SmallFunction(std::nullptr_t) noexcept
+{}
+
+template <typename R, typename... Args, std::size_t Capacity>
+template <typename F>
+    requires(!std::is_same_v<std::remove_cvref_t<F>, SmallFunction<R(Args...), Capacity>>
+             && std::is_invocable_r_v<R, std::decay_t<F>&, Args...>)
+SmallFunction<R(Args...), Capacity>::SmallFunction(F&& function)
+{
+    using Function = std::decay_t<F>;
+    static_assert(sizeof(Function*) <= Capacity, "SmallFunction must at least hold a pointer");
+    if constexpr (fits_inline<Function>)
+    {
+        ::new (static_cast<void*>(m_storage)) Function(std::forward<F>(function));
+        m_operations = &InlineOperations<Function>::operations;
+    }
+    else
+    {
+        ::new (static_cast<void*>(m_storage)) Function*(new Function(std::forward<F>(function)));
+        m_operations = &HeapOperations<Function>::operations;
+    }
+}
+
+template <typename R, typename... Args, std::size_t Capacity>
+inline SmallFunction<R(Args...), Capacity>::SmallFunction(SmallFunction&& other) noexcept
+ : m_operations(other.m_operations)
+{
+    if (m_operations != nullptr)
+    {
+        m_operations->move(other.m_storage, m_storage);
+        other.m_operations = nullptr;
+    }
+}
+
+template <typename R, typename... Args, std::size_t Capacity>
+inline SmallFunction<R(Args...), Capacity>& SmallFunction<R(Args...), Capacity>::operator=(SmallFunction&& other) noexcept
+{
+    if (&other == this)
+        return *this;
+    reset();
+    m_operations = other.m_operations;
+    if (m_operations != nullptr)
+    {
+        m_operations->move(other.m_storage, m_storage);
+        other.m_operations = nullptr;
+    }
+    return *this;
+}
+
+template <typename R, typename... Args, std::size_t Capacity>
+inline SmallFunction<R(Args...), Capacity>::~SmallFunction()
+{
+    reset();
+}
+
+template <typename R, typename... Args, std::size_t Capacity>
+inline R SmallFunction<R(Args...), Capacity>::operator()(Args... args)
+{
+    return m_operations->invoke(m_storage, std::forward<Args>(args)...);
+}
+
+template <typename R, typename... Args, std::size_t Capacity>
+inline SmallFunction<R(Args...), Capacity>::operator bool() const noexcept
+{
+    return m_operations != nullptr;
+}
+
+template <typename R, typename... Args, std::size_t Capacity>
+inline bool SmallFunction<R(Args...), Capacity>::is_inline() const noexcept
+{
+    return m_operations != nullptr && m_operations->is_inline;
+}
+
+template <typename R, typename... Args, std::size_t Capacity>
+inline void SmallFunction<R(Args...), Capacity>::reset() noexcept
+{
+    if (m_operations != nullptr)
+    {
+        m_operations->destroy(m_storage);
+        m_operations = nullptr;
+    }
+}
+
+}
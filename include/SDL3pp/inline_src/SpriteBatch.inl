@@ -0,0 +1,17 @@
+#include <cstddef>
+#include <SDL3pp/SpriteBatch.hpp>
+
+namespace SDL3pp
+{
+
+inline std::size_t SpriteBatch::get_size() const noexcept
+{
+    return m_sprites.size();
+}
+
+inline std::size_t SpriteBatch::get_draw_calls() const noexcept
+{
+    return m_draw_calls;
+}
+
+}
@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <SDL3pp/SpscRing.hpp>
+
+namespace SDL3pp
+{
+
+template <typename T>
+SpscRing<T>::SpscRing(std::size_t capacity)
+ : m_items(std::make_unique<T[]>(std::bit_ceil(std::max<std::size_t>(capacity, 1)))),
+   m_mask(std::bit_ceil(std::max<std::size_t>(capacity, 1)) - 1)
+{}
+
+template <typename T>
+std::size_t SpscRing<T>::write(std::span<const T> items) noexcept
+{
+    // The indices grow forever, their difference is the number of items
+    const std::size_t write_index = m_write_index.load(std::memory_order_relaxed);
+    if (get_capacity() - (write_index - m_cached_read_index) < items.size())
+        m_cached_read_index = m_read_index.load(std::memory_order_acquire);
+
+    const std::size_t count = std::min(items.size(), get_capacity() - (write_index - m_cached_read_index));
+    if (count == 0)
+        return 0;
+    const std::size_t start = write_index & m_mask;
+    const std::size_t first = std::min(count, get_capacity() - start);
+    std::memcpy(m_items.get() + start, items.data(), first * sizeof(T));
+    std::memcpy(m_items.get(), items.data() + first, (count - first) * sizeof(T));
+
+    m_write_index.store(write_index + count, std::memory_order_release);
+    return count;
+}
+
+template <typename T>
+std::size_t SpscRing<T>::read(std::span<T> items) noexcept
+{
+    const std::size_t read_index = m_read_index.load(std::memory_order_relaxed);
+    if (m_cached_write_index - read_index < items.size())
+        m_cached_write_index = m_write_index.load(std::memory_order_acquire);
+
+    const std::size_t count = std::min(items.size(), m_cached_write_index - read_index);
+    if (count == 0)
+        return 0;
+    const std::size_t start = read_index & m_mask;
+    const std::size_t first = std::min(count, get_capacity() - start);
+    std::memcpy(items.data(), m_items.get() + start, first * sizeof(T));
+    std::memcpy(items.data() + first, m_items.get(), (count - first) * sizeof(T));
+
+    m_read_index.store(read_index + count, std::memory_order_release);
+    return count;
+}
+
+template <typename T>
+inline std::size_t SpscRing<T>::get_size() const noexcept
+{
+    const std::size_t read_index = m_read_index.load(std::memory_order_acquire);
+    return m_write_index.load(std::memory_order_acquire) - read_index;
+}
+
+template <typename T>
+inline std::size_t SpscRing<T>::get_free() const noexcept
+{
+    return get_capacity() - get_size();
+}
+
+template <typename T>
+inline std::size_t SpscRing<T>::get_capacity() const noexcept
+{
+    return m_mask + 1;
+}
+
+}
@@ -0,0 +1,59 @@
+#include <cstddef>
+#include <utility>
+#include <SDL3pp/StreamingTexture.hpp>
+
+namespace SDL3pp
+{
+
+inline StreamingTexture::Frame::Frame(StreamingTexture& owner, std::size_t slot) noexcept
+ : m_owner(&owner),
+   m_slot(slot)
+{}
+
+inline StreamingTexture::Frame::Frame(Frame&& other) noexcept
+ : m_owner(std::exchange(other.m_owner, nullptr)),
+   m_slot(other.m_slot)
+{}
+
+inline StreamingTexture::Frame::~Frame()
+{
+    if (m_owner != nullptr)
+        m_owner->cancel(m_slot);
+}
+
+inline void* StreamingTexture::Frame::get_pixels() const noexcept
+{
+    return m_owner->m_slots[m_slot].pixels.data();
+}
+
+inline int StreamingTexture::Frame::get_pitch() const noexcept
+{
+    return m_owner->m_pitch;
+}
+
+inline int StreamingTexture::Frame::get_width() const noexcept
+{
+    return m_owner->m_width;
+}
+
+inline int StreamingTexture::Frame::get_height() const noexcept
+{
+    return m_owner->m_height;
+}
+
+inline Texture const& StreamingTexture::get_texture() const noexcept
+{
+    return m_textures[m_current];
+}
+
+inline int StreamingTexture::get_width() const noexcept
+{
+    return m_width;
+}
+
+inline int StreamingTexture::get_height() const noexcept
+{
+    return m_height;
+}
+
+}
@@ -0,0 +1,117 @@
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <SDL3/SDL_surface.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/Point.hpp>
+#include <SDL3pp/Profiler.hpp>
+#include <SDL3pp/Rect.hpp>
+#include <SDL3pp/Surface.hpp>
+
+namespace SDL3pp
+{
+
+// Rect only adds member functions to SDL_Rect, so an array of Rect can be
+// handed over to SDL as an array of SDL_Rect.
+static_assert(sizeof(Rect) == sizeof(SDL_Rect) && std::is_standard_layout_v<Rect>);
+
+// The deleter of unique_handle is an empty base
+static_assert(sizeof(Surface) == sizeof(SDL_Surface*));
+
+inline Surface::Surface(SDL_Surface* surface)
+ : m_surface(surface)
+{}
+
+inline int Surface::get_width() const noexcept
+{
+    return get()->w;
+}
+
+inline int Surface::get_height() const noexcept
+{
+    return get()->h;
+}
+
+inline std::pair<int, int> Surface::get_size() const noexcept
+{
+    return std::make_pair(get()->w, get()->h);
+}
+
+inline int Surface::get_pitch() const noexcept
+{
+    return get()->pitch;
+}
+
+inline PixelFormat Surface::get_format() const noexcept
+{
+    return get()->format;
+}
+
+inline void* Surface::get_pixels() const noexcept
+{
+    return get()->pixels;
+}
+
+inline Uint32 Surface::map_color(Color const& color) const noexcept
+{
+    return SDL3PP_CALL(SDL_MapSurfaceRGBA, get(), color.r, color.g, color.b, color.a);
+}
+
+inline void Surface::fill_rect(Rect const& rect, Color const& color)
+{
+    if (!SDL3PP_CALL(SDL_FillSurfaceRect, get(), reinterpret_cast<const SDL_Rect*>(&rect), map_color(color)))
+    {
+        throw Exception("SDL_FillSurfaceRect");
+    }
+}
+
+inline void Surface::fill_rects(std::span<const Rect> rects, Color const& color)
+{
+    if (rects.empty())
+        return;
+    if (!SDL3PP_CALL(SDL_FillSurfaceRects, get(), reinterpret_cast<const SDL_Rect*>(rects.data()),
+                     static_cast<int>(rects.size()), map_color(color)))
+    {
+        throw Exception("SDL_FillSurfaceRects");
+    }
+}
+
+inline void Surface::fill(Color const& color)
+{
+    if (!SDL3PP_CALL(SDL_FillSurfaceRect, get(), nullptr, map_color(color)))
+    {
+        throw Exception("SDL_FillSurfaceRect");
+    }
+}
+
+inline void Surface::blit(std::optional<Rect> const& src_rect, Surface& dst, Point const& position) const
+{
+    SDL3PP_ZONE("Surface::blit");
+    const Rect dst_rect(position, 0, 0);
+    if (!SDL3PP_CALL(SDL_BlitSurface, get(),
+                     src_rect ? reinterpret_cast<const SDL_Rect*>(&*src_rect) : nullptr,
+                     dst.get(),
+                     reinterpret_cast<const SDL_Rect*>(&dst_rect)))
+    {
+        throw Exception("SDL_BlitSurface");
+    }
+}
+
+inline Surface Surface::convert(PixelFormat format) const
+{
+    SDL_Surface* converted = SDL3PP_CALL(SDL_ConvertSurface, get(), format);
+    if (converted == nullptr)
+    {
+        throw Exception("SDL_ConvertSurface");
+    }
+    return Surface(converted);
+}
+
+inline SDL_Surface* Surface::get() const noexcept
+{
+    return m_surface.get();
+}
+
+}
@@ -0,0 +1,262 @@
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <utility>
+#include <SDL3pp/CoroutineFramePool.hpp>
+#include <SDL3pp/Task.hpp>
+
+namespace SDL3pp
+{
+
+inline void* TaskPromiseBase::operator new(std::size_t size)
+{
+    return CoroutineFramePool::allocate(size);
+}
+
+inline void TaskPromiseBase::operator delete(void* frame, std::size_t size) noexcept
+{
+    CoroutineFramePool::deallocate(frame, size);
+}
+
+inline std::suspend_always TaskPromiseBase::initial_suspend() const noexcept
+{
+    return {};
+}
+
+inline auto TaskPromiseBase::final_suspend() noexcept
+{
+    return FinalAwaiter {this};
+}
+
+inline void TaskPromiseBase::unhandled_exception() noexcept
+{
+    m_exception = std::current_exception();
+}
+
+inline TaskScheduler* TaskPromiseBase::get_scheduler() const noexcept
+{
+    return m_scheduler;
+}
+
+inline void TaskPromiseBase::rethrow_if_failed() const
+{
+    if (m_exception)
+        std::rethrow_exception(m_exception);
+}
+
+inline bool TaskPromiseBase::FinalAwaiter::await_ready() const noexcept
+{
+    return false;
+}
+
+inline std::coroutine_handle<> TaskPromiseBase::FinalAwaiter::await_suspend(std::coroutine_handle<>) noexcept
+{
+    if (promise->m_continuation)
+        return promise->m_continuation;
+    // Destroys the frame, and this awaiter with it
+    if (promise->m_spawned_handle)
+        promise->m_scheduler->finish(*promise);
+    return std::noop_coroutine();
+}
+
+inline void TaskPromiseBase::FinalAwaiter::await_resume() const noexcept
+{}
+
+template <typename T>
+inline Task<T> TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+template <typename T>
+template <typename U>
+    requires std::convertible_to<U&&, T>
+void TaskPromise<T>::return_value(U&& value)
+{
+    m_result.emplace(std::forward<U>(value));
+}
+
+template <typename T>
+T TaskPromise<T>::take_result()
+{
+    rethrow_if_failed();
+    return std::move(*m_result);
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+inline void TaskPromise<void>::return_void() const noexcept
+{}
+
+inline void TaskPromise<void>::take_result() const
+{
+    rethrow_if_failed();
+}
+
+template <typename T>
+inline Task<T>::Task(std::coroutine_handle<promise_type> handle) noexcept
+ : m_handle(handle)
+{}
+
+template <typename T>
+inline Task<T>::Task(Task&& other) noexcept
+ : m_handle(std::exchange(other.m_handle, nullptr))
+{}
+
+template <typename T>
+inline Task<T>& Task<T>::operator=(Task&& other) noexcept
+{
+    if (&other == this)
+        return *this;
+    if (m_handle)
+        m_handle.destroy();
+    m_handle = std::exchange(other.m_handle, nullptr);
+    return *this;
+}
+
+template <typename T>
+inline Task<T>::~Task()
+{
+    if (m_handle)
+        m_handle.destroy();
+}
+
+template <typename T>
+inline bool Task<T>::is_done() const noexcept
+{
+    return m_handle && m_handle.done();
+}
+
+template <typename T>
+class Task<T>::Awaiter
+{
+public:
+    bool await_ready() const noexcept
+    {
+        return m_handle.done();
+    }
+
+    // Symmetric transfer: the awaiting coroutine suspends and the task
+    // starts, without growing the stack
+    template <std::derived_from<TaskPromiseBase> Promise>
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> awaiting) noexcept
+    {
+        m_handle.promise().m_continuation = awaiting;
+        m_handle.promise().m_scheduler = awaiting.promise().m_scheduler;
+        return m_handle;
+    }
+
+    T await_resume()
+    {
+        return m_handle.promise().take_result();
+    }
+
+private:
+    friend class Task<T>;
+
+    explicit Awaiter(std::coroutine_handle<promise_type> handle) noexcept
+     : m_handle(handle)
+    {}
+
+    std::coroutine_handle<promise_type> m_handle;
+};
+
+template <typename T>
+inline typename Task<T>::Awaiter Task<T>::operator co_await() noexcept
+{
+    return Awaiter(m_handle);
+}
+
+inline Uint64 TaskScheduler::get_ticks() const noexcept
+{
+    return m_ticks;
+}
+
+inline std::uint64_t TaskScheduler::get_frame() const noexcept
+{
+    return m_frame;
+}
+
+inline std::size_t TaskScheduler::get_task_count() const noexcept
+{
+    return m_task_count;
+}
+
+inline bool TaskScheduler::is_later(Timer const& a, Timer const& b) noexcept
+{
+    return a.deadline != b.deadline ? a.deadline > b.deadline : a.sequence > b.sequence;
+}
+
+inline bool TaskScheduler::NextFrameAwaiter::await_ready() const noexcept
+{
+    return false;
+}
+
+template <std::derived_from<TaskPromiseBase> Promise>
+void TaskScheduler::NextFrameAwaiter::await_suspend(std::coroutine_handle<Promise> handle)
+{
+    handle.promise().get_scheduler()->m_next_frame.push_back(handle);
+}
+
+inline void TaskScheduler::NextFrameAwaiter::await_resume() const noexcept
+{}
+
+inline TaskScheduler::DelayAwaiter::DelayAwaiter(std::chrono::milliseconds duration) noexcept
+ : m_duration(duration)
+{}
+
+inline bool TaskScheduler::DelayAwaiter::await_ready() const noexcept
+{
+    return m_duration.count() <= 0;
+}
+
+template <std::derived_from<TaskPromiseBase> Promise>
+void TaskScheduler::DelayAwaiter::await_suspend(std::coroutine_handle<Promise> handle)
+{
+    TaskScheduler& scheduler = *handle.promise().get_scheduler();
+    const Uint64 deadline = scheduler.m_ticks + static_cast<Uint64>(m_duration.count());
+    scheduler.m_timers.push_back({deadline, scheduler.m_timer_sequence++, handle});
+    std::push_heap(scheduler.m_timers.begin(), scheduler.m_timers.end(), &TaskScheduler::is_later);
+}
+
+inline void TaskScheduler::DelayAwaiter::await_resume() const noexcept
+{}
+
+inline TaskScheduler::LoadSurfaceAwaiter::LoadSurfaceAwaiter(std::string path) noexcept
+ : m_path(std::move(path))
+{}
+
+inline bool TaskScheduler::LoadSurfaceAwaiter::await_ready() const noexcept
+{
+    return false;
+}
+
+template <std::derived_from<TaskPromiseBase> Promise>
+void TaskScheduler::LoadSurfaceAwaiter::await_suspend(std::coroutine_handle<Promise> handle)
+{
+    handle.promise().get_scheduler()->load(*this, handle);
+}
+
+inline TaskScheduler::NextFrameAwaiter next_frame() noexcept
+{
+    return {};
+}
+
+inline TaskScheduler::DelayAwaiter delay(std::chrono::milliseconds duration) noexcept
+{
+    return TaskScheduler::DelayAwaiter(duration);
+}
+
+inline TaskScheduler::LoadSurfaceAwaiter load_surface(std::string path)
+{
+    return TaskScheduler::LoadSurfaceAwaiter(std::move(path));
+}
+
+}
@@ -0,0 +1,38 @@
+#include <cstddef>
+#include <string_view>
+#include <SDL3pp/TextLayout.hpp>
+
+namespace SDL3pp
+{
+
+inline std::size_t TextLayout::get_paragraph_count() const noexcept
+{
+    return m_paragraphs.size();
+}
+
+inline std::string_view TextLayout::get_paragraph(std::size_t paragraph) const noexcept
+{
+    return m_paragraphs[paragraph].text;
+}
+
+inline int TextLayout::get_wrap_width() const noexcept
+{
+    return m_wrap_width;
+}
+
+inline int TextLayout::get_height() const noexcept
+{
+    return m_total_height;
+}
+
+inline TextLayoutStats const& TextLayout::get_stats() const noexcept
+{
+    return m_stats;
+}
+
+inline void TextLayout::reset_stats() noexcept
+{
+    m_stats = TextLayoutStats();
+}
+
+}
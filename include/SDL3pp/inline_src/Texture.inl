@@ -0,0 +1,58 @@
+#include <optional>
+#include <utility>
+#include <SDL3/SDL_render.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/Rect.hpp>
+#include <SDL3pp/Texture.hpp>
+
+namespace SDL3pp
+{
+
+inline Texture::Texture(SDL_Texture* texture)
+ : m_texture(texture)
+{}
+
+inline int Texture::get_width() const noexcept
+{
+    return get()->w;
+}
+
+inline int Texture::get_height() const noexcept
+{
+    return get()->h;
+}
+
+inline std::pair<int, int> Texture::get_size() const noexcept
+{
+    return std::make_pair(get()->w, get()->h);
+}
+
+inline PixelFormat Texture::get_format() const noexcept
+{
+    return get()->format;
+}
+
+inline void Texture::set_blend_mode(BlendMode mode)
+{
+    if (!SDL3PP_CALL(SDL_SetTextureBlendMode, get(), mode))
+    {
+        throw Exception("SDL_SetTextureBlendMode");
+    }
+}
+
+inline void Texture::update(std::optional<Rect> const& rect, const void* pixels, int pitch)
+{
+    if (!SDL3PP_CALL(SDL_UpdateTexture, get(), rect ? reinterpret_cast<const SDL_Rect*>(&*rect) : nullptr, pixels,
+                     pitch))
+    {
+        throw Exception("SDL_UpdateTexture");
+    }
+}
+
+inline SDL_Texture* Texture::get() const noexcept
+{
+    return m_texture.get();
+}
+
+}
@@ -0,0 +1,36 @@
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <SDL3pp/TimerWheel.hpp>
+
+namespace SDL3pp
+{
+
+template <typename F>
+TimerHandle TimerWheel::add(Uint64 delay, F&& callback, Uint64 interval)
+{
+    return insert(Callback(std::forward<F>(callback)), delay, interval);
+}
+
+inline bool TimerWheel::is_pending(TimerHandle timer) const noexcept
+{
+    return timer.index < m_timers.size() && m_timers[timer.index].generation == timer.generation
+        && m_timers[timer.index].pending;
+}
+
+inline bool TimerWheel::is_dispatch_pending() const noexcept
+{
+    return m_dispatch_pending.load(std::memory_order_acquire);
+}
+
+inline Uint64 TimerWheel::get_ticks() const noexcept
+{
+    return m_ticks;
+}
+
+inline std::size_t TimerWheel::get_size() const noexcept
+{
+    return m_size;
+}
+
+}
@@ -0,0 +1,27 @@
+#include <cstddef>
+#include <SDL3pp/VoiceMixer.hpp>
+
+namespace SDL3pp
+{
+
+inline std::size_t VoiceMixer::get_capacity() const noexcept
+{
+    return m_voices.size();
+}
+
+inline std::size_t VoiceMixer::get_active_count() const noexcept
+{
+    return m_active.size();
+}
+
+inline VoiceMixerStats const& VoiceMixer::get_stats() const noexcept
+{
+    return m_stats;
+}
+
+inline void VoiceMixer::reset_stats() noexcept
+{
+    m_stats = VoiceMixerStats();
+}
+
+}
@@ -3,6 +3,7 @@
 #include <string_view>
 #include <source_location>
 #include <SDL3/SDL_video.h>
+#include <SDL3pp/CallTracker.hpp>
 #include <SDL3pp/Exception.hpp>
 #include <SDL3pp/Point.hpp>
 #include <SDL3pp/Window.hpp>
@@ -17,7 +18,7 @@ inline Window::Window(SDL_Window* window)
 inline std::pair<int, int> Window::get_size() const
 {
     int width, height;
-    if (!SDL_GetWindowSize(const_cast<SDL_Window*>(m_window.get()), &width, &height))
+    if (!SDL3PP_CALL(SDL_GetWindowSize, m_window.get(), &width, &height))
     {
         const std::source_location& loc {std::source_location::current()};
         throw Exception(loc.function_name());
@@ -28,7 +29,7 @@ inline std::pair<int, int> Window::get_size() const
 inline int Window::get_width() const
 {
     int width;
-    if(!SDL_GetWindowSize(const_cast<SDL_Window*>(m_window.get()), &width, nullptr))
+    if(!SDL3PP_CALL(SDL_GetWindowSize, m_window.get(), &width, nullptr))
     {
         throw Exception("SDL_GetWindowSize");
     }
@@ -38,7 +39,7 @@ inline int Window::get_width() const
 inline int Window::get_height() const
 {
     int height;
-    if(!SDL_GetWindowSize(const_cast<SDL_Window*>(m_window.get()), nullptr, &height))
+    if(!SDL3PP_CALL(SDL_GetWindowSize, m_window.get(), nullptr, &height))
     {
         throw Exception("SDL_GetWindowSize");
     }
@@ -48,7 +49,7 @@ inline int Window::get_height() const
 inline std::pair<int, int> Window::get_size_in_pixel() const
 {
     int width, height;
-    if (!SDL_GetWindowSizeInPixels(const_cast<SDL_Window*>(m_window.get()), &width, &height))
+    if (!SDL3PP_CALL(SDL_GetWindowSizeInPixels, m_window.get(), &width, &height))
     {
         throw Exception("SDL_GetWindowSize");
     }
@@ -58,7 +59,7 @@ inline std::pair<int, int> Window::get_size_in_pixel() const
 inline int Window::get_width_in_pixel() const
 {
     int width;
-    if(!SDL_GetWindowSizeInPixels(const_cast<SDL_Window*>(m_window.get()), &width, nullptr))
+    if(!SDL3PP_CALL(SDL_GetWindowSizeInPixels, m_window.get(), &width, nullptr))
     {
         throw Exception("SDL_GetWindowSize");
     }
@@ -68,7 +69,7 @@ inline int Window::get_width_in_pixel() const
 inline int Window::get_height_in_pixel() const
 {
     int height;
-    if(!SDL_GetWindowSizeInPixels(const_cast<SDL_Window*>(m_window.get()), nullptr, &height))
+    if(!SDL3PP_CALL(SDL_GetWindowSizeInPixels, m_window.get(), nullptr, &height))
     {
         throw Exception("SDL_GetWindowSize");
     }
@@ -77,12 +78,12 @@ inline int Window::get_height_in_pixel() const
 
 inline std::string_view Window::get_title() const
 {
-    return SDL_GetWindowTitle(const_cast<SDL_Window*>(m_window.get()));
+    return SDL3PP_CALL(SDL_GetWindowTitle, m_window.get());
 }
 
 inline void Window::set_title(std::string const& title)
 {
-    if (!SDL_SetWindowTitle(m_window.get(), title.c_str()))
+    if (!SDL3PP_CALL(SDL_SetWindowTitle, m_window.get(), title.c_str()))
     {
         throw Exception("SDL_SetWindowTitle");
     }
@@ -90,7 +91,7 @@ inline void Window::set_title(std::string const& title)
 
 inline observer_ptr<Window> Window::get_parent() const
 {
-    if (SDL_GetWindowParent(const_cast<SDL_Window*>(m_window.get())) == nullptr)
+    if (SDL3PP_CALL(SDL_GetWindowParent, m_window.get()) == nullptr)
     {
         return nullptr;
     }
@@ -99,7 +100,7 @@ inline observer_ptr<Window> Window::get_parent() const
 
 inline void Window::set_parent(Window& parent)
 {
-    if (!SDL_SetWindowParent(m_window, parent.m_window))
+    if (!SDL3PP_CALL(SDL_SetWindowParent, m_window.get(), parent.m_window.get()))
     {
         throw Exception("SDL_SetWindowParent");
     }
@@ -109,8 +110,13 @@ inline void Window::set_parent(Window& parent)
 inline Point Window::get_position() const
 {
     int x, y;
-    SDL_GetWindowPosition(const_cast<SDL_Window*>(m_window.get()), &x, &y);
+    SDL3PP_CALL(SDL_GetWindowPosition, m_window.get(), &x, &y);
     return Point(x, y);
 }
 
+inline SDL_Window* Window::get() const noexcept
+{
+    return m_window.get();
+}
+
 }
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <SDL3pp/WorkStealingDeque.hpp>
+
+namespace SDL3pp
+{
+
+template <typename T>
+WorkStealingDeque<T>::WorkStealingDeque(std::size_t capacity)
+ : m_items(std::make_unique<std::atomic<T>[]>(std::bit_ceil(std::max<std::size_t>(capacity, 1)))),
+   m_mask(static_cast<std::int64_t>(std::bit_ceil(std::max<std::size_t>(capacity, 1))) - 1)
+{}
+
+template <typename T>
+bool WorkStealingDeque<T>::push(T item) noexcept
+{
+    const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+    const std::int64_t top = m_top.load(std::memory_order_acquire);
+    if (bottom - top > m_mask)
+        return false;
+    m_items[static_cast<std::size_t>(bottom & m_mask)].store(item, std::memory_order_relaxed);
+    // Publish the item before the new bottom
+    m_bottom.store(bottom + 1, std::memory_order_release);
+    return true;
+}
+
+template <typename T>
+std::optional<T> WorkStealingDeque<T>::pop() noexcept
+{
+    const std::int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    // Reserve the bottom item before looking at the top: a thief reading
+    // the old bottom after this exchange is ordered against it
+    m_bottom.exchange(bottom, std::memory_order_seq_cst);
+    std::int64_t top = m_top.load(std::memory_order_seq_cst);
+
+    if (top > bottom)
+    {
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        return std::nullopt;
+    }
+    std::optional<T> item = m_items[static_cast<std::size_t>(bottom & m_mask)].load(std::memory_order_relaxed);
+    if (top == bottom)
+    {
+        // Last item: race the thieves for it
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            item.reset();
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+    return item;
+}
+
+template <typename T>
+std::optional<T> WorkStealingDeque<T>::steal() noexcept
+{
+    std::int64_t top = m_top.load(std::memory_order_seq_cst);
+    const std::int64_t bottom = m_bottom.load(std::memory_order_seq_cst);
+    if (top >= bottom)
+        return std::nullopt;
+    const T item = m_items[static_cast<std::size_t>(top & m_mask)].load(std::memory_order_relaxed);
+    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return std::nullopt;
+    return item;
+}
+
+template <typename T>
+inline std::size_t WorkStealingDeque<T>::get_size() const noexcept
+{
+    const std::int64_t top = m_top.load(std::memory_order_relaxed);
+    return static_cast<std::size_t>(std::max<std::int64_t>(m_bottom.load(std::memory_order_relaxed) - top, 0));
+}
+
+template <typename T>
+inline std::size_t WorkStealingDeque<T>::get_capacity() const noexcept
+{
+    return static_cast<std::size_t>(m_mask + 1);
+}
+
+}
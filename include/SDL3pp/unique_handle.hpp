@@ -0,0 +1,210 @@
+#ifndef SDL3PP_UNIQUE_HANDLE_HPP
+#define SDL3PP_UNIQUE_HANDLE_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Lets Clang pass and relocate the handles in registers, as raw pointers
+#if defined(__has_cpp_attribute)
+#if __has_cpp_attribute(clang::trivial_abi)
+#define SDL3PP_TRIVIAL_ABI [[clang::trivial_abi]]
+#endif
+#endif
+#ifndef SDL3PP_TRIVIAL_ABI
+#define SDL3PP_TRIVIAL_ABI
+#endif
+
+namespace SDL3pp
+{
+
+/**
+ * @brief Whether moving an object then destroying the source is equivalent
+ *        to copying its bytes
+ *
+ * True for the trivially copyable types; the owning wrappers of SDL3pp
+ * specialize it, as they only hold handles. uninitialized_relocate() uses
+ * it to move arrays of them with std::memcpy.
+ */
+template <class T>
+struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+{
+};
+
+template <class T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<T>::value;
+
+/**
+ * @brief Stateless deleter calling an SDL destruction function
+ */
+template <class T, auto Destroy>
+struct handle_deleter
+{
+    void operator()(T* handle) const noexcept
+    {
+        static_cast<void>(Destroy(handle));
+    }
+};
+
+/**
+ * @brief Owner of an SDL object, destroyed by Destroy
+ *
+ * The deleter is an empty base, so a unique_handle is exactly the size of
+ * a pointer, and the handle is trivially relocatable: the objects holding
+ * only handles can be moved around with std::memcpy.
+ *
+ * @code {.cpp}
+ * SDL3pp::unique_handle<SDL_Surface, &SDL_DestroySurface> surface(SDL_CreateSurface(w, h, format));
+ * @endcode
+ */
+template <class T, auto Destroy>
+class SDL3PP_TRIVIAL_ABI unique_handle final : private handle_deleter<T, Destroy>
+{
+public:
+    using element_type = T;
+    using pointer = T*;
+    using deleter_type = handle_deleter<T, Destroy>;
+
+    constexpr unique_handle() noexcept = default;
+
+    constexpr unique_handle(std::nullptr_t) noexcept
+    {
+    }
+
+    constexpr explicit unique_handle(pointer handle) noexcept
+     : m_handle(handle)
+    {
+    }
+
+    unique_handle(unique_handle const&) = delete;
+    unique_handle& operator=(unique_handle const&) = delete;
+
+    constexpr unique_handle(unique_handle&& other) noexcept
+     : m_handle(std::exchange(other.m_handle, nullptr))
+    {
+    }
+
+    constexpr unique_handle& operator=(unique_handle&& other) noexcept
+    {
+        reset(std::exchange(other.m_handle, nullptr));
+        return *this;
+    }
+
+    constexpr unique_handle& operator=(std::nullptr_t) noexcept
+    {
+        reset();
+        return *this;
+    }
+
+    constexpr ~unique_handle()
+    {
+        reset();
+    }
+
+    constexpr pointer get() const noexcept
+    {
+        return m_handle;
+    }
+
+    /**
+     * @brief Give up the ownership of the object without destroying it
+     */
+    [[nodiscard]] constexpr pointer release() noexcept
+    {
+        return std::exchange(m_handle, nullptr);
+    }
+
+    /**
+     * @brief Destroy the owned object, if any, and take the ownership of another one
+     */
+    constexpr void reset(pointer handle = nullptr) noexcept
+    {
+        pointer const previous = std::exchange(m_handle, handle);
+        if (previous != nullptr)
+            get_deleter()(previous);
+    }
+
+    constexpr void swap(unique_handle& other) noexcept
+    {
+        std::swap(m_handle, other.m_handle);
+    }
+
+    constexpr deleter_type get_deleter() const noexcept
+    {
+        return *this;
+    }
+
+    constexpr pointer operator->() const noexcept
+    {
+        return m_handle;
+    }
+
+    constexpr explicit operator bool() const noexcept
+    {
+        return m_handle != nullptr;
+    }
+
+    friend constexpr bool operator==(unique_handle const& handle, std::nullptr_t) noexcept
+    {
+        return handle.m_handle == nullptr;
+    }
+
+private:
+    pointer m_handle = nullptr;
+};
+
+template <class T, auto Destroy>
+struct is_trivially_relocatable<unique_handle<T, Destroy>> : std::true_type
+{
+};
+
+/**
+ * @brief Move the objects of [first, last) to the uninitialized memory at
+ *        destination, and destroy them
+ *
+ * The bytes are copied with std::memcpy when T is trivially relocatable,
+ * otherwise each object is moved then destroyed. The ranges must not
+ * overlap.
+ *
+ * SDL3pp does not use it itself: it is the primitive of the containers of
+ * the application which grow their own storage, such as a pool of
+ * Textures or Surfaces, where std::vector would move each element.
+ *
+ * @code {.cpp}
+ * auto* storage = std::allocator<SDL3pp::Texture>().allocate(new_capacity);
+ * SDL3pp::uninitialized_relocate(m_data, m_data + m_size, storage);
+ * std::allocator<SDL3pp::Texture>().deallocate(m_data, m_capacity);
+ * m_data = storage;
+ * @endcode
+ *
+ * @returns the end of the destination range.
+ */
+template <class T>
+T* uninitialized_relocate(T* first, T* last, T* destination) noexcept
+{
+    static_assert(is_trivially_relocatable_v<T> || std::is_nothrow_move_constructible_v<T>,
+                  "relocating T could leave both ranges partially constructed");
+    if constexpr (is_trivially_relocatable_v<T>)
+    {
+        const auto count = static_cast<std::size_t>(last - first);
+        if (count != 0)
+            std::memcpy(static_cast<void*>(destination), static_cast<const void*>(first), count * sizeof(T));
+        return destination + count;
+    }
+    else
+    {
+        for (; first != last; ++first, ++destination)
+        {
+            ::new (static_cast<void*>(destination)) T(std::move(*first));
+            std::destroy_at(first);
+        }
+        return destination;
+    }
+}
+
+} // namespace SDL3pp
+
+#endif
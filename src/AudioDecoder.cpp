@@ -0,0 +1,254 @@
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_iostream.h>
+#include <SDL3pp/AudioDecoder.hpp>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/MemoryTracker.hpp>
+#include <SDL3pp/Profiler.hpp>
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+// Format tags of the fmt chunk
+constexpr std::uint16_t format_pcm = 0x0001;
+constexpr std::uint16_t format_float = 0x0003;
+constexpr std::uint16_t format_extensible = 0xFFFE;
+
+// Frames read from the stream at once, the default chunk of MusicStream:
+// larger chunks are read in several pieces, so that decode() never allocates
+constexpr std::size_t raw_frames = 4096;
+
+SDL_IOStream* open_file(std::string const& file)
+{
+    const MemoryScope scope(MemoryTag::io);
+    SDL_IOStream* const stream = SDL3PP_CALL(SDL_IOFromFile, file.c_str(), "rb");
+    if (stream == nullptr)
+    {
+        throw Exception("SDL_IOFromFile");
+    }
+    return stream;
+}
+
+[[noreturn]] void fail(const char* reason)
+{
+    SDL_SetError("Invalid WAV file: %s", reason);
+    throw Exception("WavDecoder::WavDecoder");
+}
+
+void read_id(SDL_IOStream* stream, char (&id)[4])
+{
+    if (SDL3PP_CALL(SDL_ReadIO, stream, id, sizeof(id)) != sizeof(id))
+        fail("truncated header");
+}
+
+std::uint16_t read_u16(SDL_IOStream* stream)
+{
+    Uint16 value = 0;
+    if (!SDL3PP_CALL(SDL_ReadU16LE, stream, &value))
+        fail("truncated header");
+    return value;
+}
+
+std::uint32_t read_u32(SDL_IOStream* stream)
+{
+    Uint32 value = 0;
+    if (!SDL3PP_CALL(SDL_ReadU32LE, stream, &value))
+        fail("truncated header");
+    return value;
+}
+
+void skip(SDL_IOStream* stream, std::int64_t bytes)
+{
+    if (bytes > 0 && SDL3PP_CALL(SDL_SeekIO, stream, bytes, SDL_IO_SEEK_CUR) < 0)
+    {
+        throw Exception("SDL_SeekIO");
+    }
+}
+
+bool is_id(const char (&id)[4], const char* expected)
+{
+    return std::memcmp(id, expected, sizeof(id)) == 0;
+}
+
+/**
+ * Convert little-endian samples to float32, the bytes being assembled one
+ * by one so the decoding does not depend on the endianness of the host.
+ */
+void convert(const std::uint8_t* raw, float* samples, std::size_t count, int bits, bool is_float) noexcept
+{
+    switch (bits)
+    {
+    case 8:
+        for (std::size_t i = 0; i < count; ++i)
+            samples[i] = static_cast<float>(raw[i] - 128) / 128.f;
+        break;
+    case 16:
+        for (std::size_t i = 0; i < count; ++i, raw += 2)
+            samples[i] = static_cast<float>(static_cast<std::int16_t>(raw[0] | raw[1] << 8)) / 32768.f;
+        break;
+    case 24:
+        for (std::size_t i = 0; i < count; ++i, raw += 3)
+        {
+            // Shift the sign bit of the sample up to bit 31 and back down
+            const auto value = static_cast<std::int32_t>(static_cast<std::uint32_t>(raw[0] << 8 | raw[1] << 16
+                                                                                    | raw[2] << 24)) >> 8;
+            samples[i] = static_cast<float>(value) / 8388608.f;
+        }
+        break;
+    default:
+        for (std::size_t i = 0; i < count; ++i, raw += 4)
+        {
+            const std::uint32_t value = static_cast<std::uint32_t>(raw[0]) | static_cast<std::uint32_t>(raw[1]) << 8
+                                      | static_cast<std::uint32_t>(raw[2]) << 16
+                                      | static_cast<std::uint32_t>(raw[3]) << 24;
+            samples[i] = is_float ? std::bit_cast<float>(value)
+                                  : static_cast<float>(static_cast<std::int32_t>(value)) / 2147483648.f;
+        }
+        break;
+    }
+}
+
+}
+
+WavDecoder::WavDecoder(std::string const& file)
+ : WavDecoder(open_file(file))
+{
+}
+
+WavDecoder::WavDecoder(SDL_IOStream* stream)
+ : m_stream(stream),
+   m_channels(0),
+   m_frequency(0),
+   m_bits(0),
+   m_float(false),
+   m_data_offset(0),
+   m_length(0),
+   m_position(0),
+   m_raw()
+{
+    // m_stream closes the stream if the header is invalid
+    parse_header();
+    m_raw.resize(raw_frames * static_cast<std::size_t>(m_channels) * static_cast<std::size_t>(m_bits / 8));
+}
+
+std::size_t WavDecoder::decode(std::span<float> samples) noexcept
+{
+    SDL3PP_ZONE("WavDecoder::decode");
+    const auto channels = static_cast<std::size_t>(m_channels);
+    const std::size_t frame_size = channels * static_cast<std::size_t>(m_bits / 8);
+    const std::size_t requested = std::min(samples.size() / channels, m_length - m_position);
+    SDL_IOStream* const stream = m_stream.get();
+    std::size_t decoded = 0;
+    while (decoded < requested)
+    {
+        const std::size_t wanted = std::min(requested - decoded, raw_frames);
+        const std::size_t read = SDL3PP_CALL(SDL_ReadIO, stream, m_raw.data(), wanted * frame_size);
+        const std::size_t frames = read / frame_size;
+
+        // Leave a partially read frame to the next call
+        if (read % frame_size != 0)
+            SDL3PP_CALL(SDL_SeekIO, stream, -static_cast<Sint64>(read % frame_size), SDL_IO_SEEK_CUR);
+
+        convert(m_raw.data(), samples.data() + decoded * channels, frames * channels, m_bits, m_float);
+        decoded += frames;
+        if (frames < wanted)
+            break;
+    }
+    m_position += decoded;
+    return decoded;
+}
+
+bool WavDecoder::rewind() noexcept
+{
+    if (SDL3PP_CALL(SDL_SeekIO, m_stream.get(), m_data_offset, SDL_IO_SEEK_SET) < 0)
+        return false;
+    m_position = 0;
+    return true;
+}
+
+void WavDecoder::parse_header()
+{
+    SDL_IOStream* const stream = m_stream.get();
+    char id[4];
+    read_id(stream, id);
+    read_u32(stream);
+    char wave[4];
+    read_id(stream, wave);
+    if (!is_id(id, "RIFF") || !is_id(wave, "WAVE"))
+        fail("not a RIFF WAVE file");
+
+    std::uint16_t format = 0;
+    std::uint16_t block_align = 0;
+    std::uint32_t data_size = 0;
+    for (;;)
+    {
+        read_id(stream, id);
+        const std::uint32_t size = read_u32(stream);
+        // Chunks are padded to an even size
+        const std::int64_t padded = static_cast<std::int64_t>(size) + (size & 1);
+
+        if (is_id(id, "fmt "))
+        {
+            if (size < 16)
+                fail("fmt chunk too small");
+            format = read_u16(stream);
+            m_channels = read_u16(stream);
+            m_frequency = static_cast<int>(read_u32(stream));
+            read_u32(stream);
+            block_align = read_u16(stream);
+            m_bits = read_u16(stream);
+            std::int64_t consumed = 16;
+            if (format == format_extensible && size >= 26)
+            {
+                // cbSize, valid bits and channel mask precede the sub-format
+                read_u16(stream);
+                read_u16(stream);
+                read_u32(stream);
+                format = read_u16(stream);
+                consumed = 26;
+            }
+            skip(stream, padded - consumed);
+        }
+        else if (is_id(id, "data"))
+        {
+            if (format == 0)
+                fail("data chunk before fmt chunk");
+            data_size = size;
+            m_data_offset = SDL3PP_CALL(SDL_TellIO, stream);
+            if (m_data_offset < 0)
+            {
+                throw Exception("SDL_TellIO");
+            }
+            break;
+        }
+        else
+        {
+            skip(stream, padded);
+        }
+    }
+
+    if (m_channels <= 0 || m_frequency <= 0)
+        fail("no channels or null frequency");
+    if (!(format == format_pcm && (m_bits == 8 || m_bits == 16 || m_bits == 24 || m_bits == 32))
+        && !(format == format_float && m_bits == 32))
+        fail("unsupported sample format");
+    if (block_align != m_channels * m_bits / 8)
+        fail("unexpected block alignment");
+    m_float = format == format_float;
+
+    // Streamed files may not know the size of their data: the reads then
+    // stop at the end of the stream
+    m_length = data_size / block_align;
+}
+
+}
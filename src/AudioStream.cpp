@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <SDL3/SDL_audio.h>
+#include <SDL3pp/AudioStream.hpp>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/MemoryTracker.hpp>
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+// Frames moved from the ring to SDL per SDL_PutAudioStreamData() call
+constexpr std::size_t scratch_frames = 1024;
+
+}
+
+AudioStream::AudioStream(int channels, int frequency, std::size_t capacity, AudioDeviceID device)
+ : m_channels(channels),
+   m_frequency(frequency),
+   m_ring(capacity * static_cast<std::size_t>(channels)),
+   m_scratch(std::make_unique<float[]>(scratch_frames * static_cast<std::size_t>(channels))),
+   m_scratch_frames(scratch_frames),
+   m_stream()
+{
+    const AudioSpec spec {SDL_AUDIO_F32, channels, frequency};
+    const MemoryScope scope(MemoryTag::audio);
+    m_stream.reset(SDL3PP_CALL(SDL_OpenAudioDeviceStream, device, &spec, &AudioStream::on_get, this));
+    if (m_stream == nullptr)
+    {
+        throw Exception("SDL_OpenAudioDeviceStream");
+    }
+}
+
+AudioStream::~AudioStream()
+{
+    // Stop the callback before the members it reads are destroyed
+    m_stream.reset();
+}
+
+std::size_t AudioStream::write(std::span<const float> samples) noexcept
+{
+    const auto channels = static_cast<std::size_t>(m_channels);
+    const std::size_t frames = samples.size() / channels;
+    const std::size_t written = m_ring.write(samples.first(std::min(frames, get_writable_frames()) * channels)) / channels;
+    if (written < frames)
+    {
+        m_overruns.fetch_add(1, std::memory_order_relaxed);
+        m_overrun_frames.fetch_add(frames - written, std::memory_order_relaxed);
+    }
+    return written;
+}
+
+AudioStreamStats AudioStream::get_stats() const noexcept
+{
+    AudioStreamStats stats;
+    stats.underruns = m_underruns.load(std::memory_order_relaxed);
+    stats.underrun_frames = m_underrun_frames.load(std::memory_order_relaxed);
+    stats.overruns = m_overruns.load(std::memory_order_relaxed);
+    stats.overrun_frames = m_overrun_frames.load(std::memory_order_relaxed);
+    stats.played_frames = m_played_frames.load(std::memory_order_relaxed);
+    stats.latency = std::chrono::nanoseconds(m_latency.load(std::memory_order_relaxed));
+    stats.min_latency = std::chrono::nanoseconds(m_min_latency.load(std::memory_order_relaxed));
+    stats.max_latency = std::chrono::nanoseconds(m_max_latency.load(std::memory_order_relaxed));
+    const std::size_t requests = m_requests.load(std::memory_order_relaxed);
+    if (requests > 0)
+        stats.average_latency = std::chrono::nanoseconds(m_total_latency.load(std::memory_order_relaxed)
+                                                         / static_cast<std::int64_t>(requests));
+    return stats;
+}
+
+void AudioStream::reset_stats() noexcept
+{
+    m_overruns.store(0, std::memory_order_relaxed);
+    m_overrun_frames.store(0, std::memory_order_relaxed);
+    // The counters of the audio thread are cleared by its next request
+    m_reset_requested.store(true, std::memory_order_release);
+}
+
+void SDLCALL AudioStream::on_get(void* userdata, SDL_AudioStream*, int additional_amount, int total_amount)
+{
+    static_cast<AudioStream*>(userdata)->feed(additional_amount, total_amount);
+}
+
+void AudioStream::feed(int additional_amount, int total_amount) noexcept
+{
+    if (m_reset_requested.exchange(false, std::memory_order_acquire))
+    {
+        m_underruns.store(0, std::memory_order_relaxed);
+        m_underrun_frames.store(0, std::memory_order_relaxed);
+        m_played_frames.store(0, std::memory_order_relaxed);
+        m_requests.store(0, std::memory_order_relaxed);
+        m_total_latency.store(0, std::memory_order_relaxed);
+    }
+
+    const auto channels = static_cast<std::size_t>(m_channels);
+    const std::size_t frame_size = channels * sizeof(float);
+
+    // Latency: what the ring holds plus what SDL still has queued
+    const std::size_t queued = static_cast<std::size_t>(std::max(total_amount - additional_amount, 0)) / frame_size;
+    const std::int64_t latency = frames_to_ns(m_ring.get_size() / channels + queued);
+    const std::size_t requests = m_requests.load(std::memory_order_relaxed);
+    m_latency.store(latency, std::memory_order_relaxed);
+    if (requests == 0 || latency < m_min_latency.load(std::memory_order_relaxed))
+        m_min_latency.store(latency, std::memory_order_relaxed);
+    if (requests == 0 || latency > m_max_latency.load(std::memory_order_relaxed))
+        m_max_latency.store(latency, std::memory_order_relaxed);
+    m_total_latency.fetch_add(latency, std::memory_order_relaxed);
+    m_requests.store(requests + 1, std::memory_order_relaxed);
+
+    std::size_t needed = (static_cast<std::size_t>(std::max(additional_amount, 0)) + frame_size - 1) / frame_size;
+    bool underrun = false;
+    while (needed > 0)
+    {
+        const std::size_t frames = std::min(needed, m_scratch_frames);
+        const std::span<float> chunk(m_scratch.get(), frames * channels);
+        const std::size_t read = m_ring.read(chunk) / channels;
+        if (read < frames)
+        {
+            std::fill(chunk.begin() + static_cast<std::ptrdiff_t>(read * channels), chunk.end(), 0.f);
+            m_underrun_frames.fetch_add(frames - read, std::memory_order_relaxed);
+            underrun = true;
+        }
+        m_played_frames.fetch_add(read, std::memory_order_relaxed);
+        SDL3PP_CALL(SDL_PutAudioStreamData, get(), chunk.data(), static_cast<int>(chunk.size_bytes()));
+        needed -= frames;
+    }
+    if (underrun)
+        m_underruns.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::int64_t AudioStream::frames_to_ns(std::size_t frames) const noexcept
+{
+    return static_cast<std::int64_t>(frames) * 1'000'000'000 / m_frequency;
+}
+
+}
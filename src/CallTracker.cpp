@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <SDL3/SDL_timer.h>
+#include <SDL3pp/CallTracker.hpp>
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+struct Registry
+{
+    std::mutex mutex;
+    // One site per function, at a stable address
+    std::vector<std::unique_ptr<CallSite>> sites;
+};
+
+// Never destroyed, as detached threads may make SDL calls at exit
+Registry& get_registry()
+{
+    static Registry* const registry = new Registry;
+    return *registry;
+}
+
+// Taken on the first accounted call, which may come from the static
+// initialization of another unit
+double get_nanoseconds_per_tick() noexcept
+{
+    static const double nanoseconds_per_tick = 1e9 / static_cast<double>(SDL_GetPerformanceFrequency());
+    return nanoseconds_per_tick;
+}
+
+std::size_t get_bucket(std::uint64_t ns) noexcept
+{
+    const auto bucket = static_cast<std::size_t>(std::bit_width(ns));
+    return bucket == 0 ? 0 : std::min(bucket - 1, call_histogram_size - 1);
+}
+
+bool more_calls(CallStats const& a, CallStats const& b) noexcept
+{
+    return a.calls > b.calls;
+}
+
+}
+
+std::uint64_t CallStats::get_percentile_ns(double percentile) const noexcept
+{
+    if (calls == 0)
+        return 0;
+    const double rank = std::clamp(percentile, 0., 100.) / 100. * static_cast<double>(calls);
+    std::uint64_t seen = 0;
+    for (std::size_t bucket = 0; bucket < histogram.size(); ++bucket)
+    {
+        seen += histogram[bucket];
+        if (static_cast<double>(seen) >= rank)
+            return std::min((std::uint64_t {2} << bucket) - 1, max_ns);
+    }
+    return max_ns;
+}
+
+CallSite::CallSite(const char* name) noexcept
+ : m_name(name)
+{}
+
+CallSite& CallTracker::get_site(const char* name)
+{
+    Registry& registry = get_registry();
+    std::lock_guard lock(registry.mutex);
+    for (std::unique_ptr<CallSite> const& site : registry.sites)
+    {
+        if (std::strcmp(site->m_name, name) == 0)
+            return *site;
+    }
+    registry.sites.push_back(std::make_unique<CallSite>(name));
+    return *registry.sites.back();
+}
+
+std::vector<CallStats> CallTracker::get_stats()
+{
+    Registry& registry = get_registry();
+    std::vector<CallStats> stats;
+    {
+        std::lock_guard lock(registry.mutex);
+        for (std::unique_ptr<CallSite> const& site : registry.sites)
+        {
+            const std::uint64_t calls = site->m_calls.load(std::memory_order_relaxed);
+            if (calls == 0)
+                continue;
+            CallStats& entry = stats.emplace_back();
+            entry.name = site->m_name;
+            entry.calls = calls;
+            entry.total_ns = site->m_total_ns.load(std::memory_order_relaxed);
+            entry.max_ns = site->m_max_ns.load(std::memory_order_relaxed);
+            for (std::size_t bucket = 0; bucket < call_histogram_size; ++bucket)
+                entry.histogram[bucket] = site->m_histogram[bucket].load(std::memory_order_relaxed);
+        }
+    }
+    std::ranges::stable_sort(stats, more_calls);
+    return stats;
+}
+
+std::vector<CallStats> CallTracker::next_frame()
+{
+    Registry& registry = get_registry();
+    std::vector<CallStats> stats;
+    {
+        std::lock_guard lock(registry.mutex);
+        for (std::unique_ptr<CallSite> const& site : registry.sites)
+        {
+            // Each counter is taken and cleared at once, so a call made
+            // meanwhile by another thread is accounted to one frame only
+            const std::uint64_t calls = site->m_calls.exchange(0, std::memory_order_relaxed);
+            CallStats entry;
+            entry.name = site->m_name;
+            entry.calls = calls;
+            entry.total_ns = site->m_total_ns.exchange(0, std::memory_order_relaxed);
+            entry.max_ns = site->m_max_ns.exchange(0, std::memory_order_relaxed);
+            for (std::size_t bucket = 0; bucket < call_histogram_size; ++bucket)
+                entry.histogram[bucket] = site->m_histogram[bucket].exchange(0, std::memory_order_relaxed);
+            if (calls != 0)
+                stats.push_back(entry);
+        }
+    }
+    std::ranges::stable_sort(stats, more_calls);
+    return stats;
+}
+
+void CallTracker::record(CallSite& site, Uint64 start, Uint64 end) noexcept
+{
+    const auto ns = static_cast<std::uint64_t>(static_cast<double>(end - start) * get_nanoseconds_per_tick());
+    site.m_calls.fetch_add(1, std::memory_order_relaxed);
+    site.m_total_ns.fetch_add(ns, std::memory_order_relaxed);
+    site.m_histogram[get_bucket(ns)].fetch_add(1, std::memory_order_relaxed);
+    std::uint64_t max = site.m_max_ns.load(std::memory_order_relaxed);
+    while (ns > max && !site.m_max_ns.compare_exchange_weak(max, ns, std::memory_order_relaxed))
+    {
+    }
+}
+
+}
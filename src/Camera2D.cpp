@@ -0,0 +1,133 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <SDL3pp/Camera2D.hpp>
+
+namespace SDL3pp
+{
+
+Camera2D::Camera2D(Rect const& viewport, float zoom, Point const& offset) noexcept
+ : m_viewport(viewport),
+   m_zoom(zoom),
+   m_offset(offset)
+{}
+
+void Camera2D::zoom_to(float zoom) noexcept
+{
+    const Point center = m_viewport.get_centroid();
+    const float scale = m_zoom / zoom;
+    m_viewport = Rect::from_center(center,
+        {static_cast<int>(std::lround(static_cast<float>(m_viewport.get_width()) * scale)),
+         static_cast<int>(std::lround(static_cast<float>(m_viewport.get_height()) * scale))});
+    m_zoom = zoom;
+}
+
+// The batch functions below hoist the camera parameters into locals and
+// keep the loop bodies free of branches so that the compiler can keep
+// everything in registers and vectorize the plain transforms.
+
+void Camera2D::transform(std::span<const Point> world, std::span<Point> screen) const noexcept
+{
+    const float origin_x = static_cast<float>(m_viewport.get_x());
+    const float origin_y = static_cast<float>(m_viewport.get_y());
+    const int offset_x = m_offset.get_x();
+    const int offset_y = m_offset.get_y();
+    const float zoom = m_zoom;
+
+    for (std::size_t i = 0; i < world.size(); ++i)
+    {
+        const float x = (static_cast<float>(world[i].get_x()) - origin_x) * zoom;
+        const float y = (static_cast<float>(world[i].get_y()) - origin_y) * zoom;
+        screen[i] = Point(offset_x + static_cast<int>(std::floor(x)),
+                          offset_y + static_cast<int>(std::floor(y)));
+    }
+}
+
+void Camera2D::transform(std::span<const Rect> world, std::span<Rect> screen) const noexcept
+{
+    const float origin_x = static_cast<float>(m_viewport.get_x());
+    const float origin_y = static_cast<float>(m_viewport.get_y());
+    const int offset_x = m_offset.get_x();
+    const int offset_y = m_offset.get_y();
+    const float zoom = m_zoom;
+
+    for (std::size_t i = 0; i < world.size(); ++i)
+    {
+        Rect const& rect = world[i];
+        const int x1 = static_cast<int>(std::floor((static_cast<float>(rect.get_x()) - origin_x) * zoom));
+        const int y1 = static_cast<int>(std::floor((static_cast<float>(rect.get_y()) - origin_y) * zoom));
+        const int x2 = static_cast<int>(std::floor((static_cast<float>(rect.get_x() + rect.get_width()) - origin_x) * zoom));
+        const int y2 = static_cast<int>(std::floor((static_cast<float>(rect.get_y() + rect.get_height()) - origin_y) * zoom));
+        screen[i] = Rect(offset_x + x1, offset_y + y1, x2 - x1, y2 - y1);
+    }
+}
+
+// The fused versions always store the transformed element at the next
+// output slot and only advance the output cursor when the element is
+// visible, so invisible elements are overwritten instead of branched
+// around. Visibility is decided in world space with integer compares.
+
+std::size_t Camera2D::transform_visible(std::span<const Point> world, std::span<Point> screen,
+                                        std::span<std::uint32_t> indices) const noexcept
+{
+    const int view_x1 = m_viewport.get_x();
+    const int view_y1 = m_viewport.get_y();
+    const int view_x2 = m_viewport.get_x2();
+    const int view_y2 = m_viewport.get_y2();
+    const float origin_x = static_cast<float>(view_x1);
+    const float origin_y = static_cast<float>(view_y1);
+    const int offset_x = m_offset.get_x();
+    const int offset_y = m_offset.get_y();
+    const float zoom = m_zoom;
+
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < world.size(); ++i)
+    {
+        const int wx = world[i].get_x();
+        const int wy = world[i].get_y();
+        const bool visible = (wx >= view_x1) & (wx <= view_x2) & (wy >= view_y1) & (wy <= view_y2);
+
+        screen[count] = Point(offset_x + static_cast<int>(std::floor((static_cast<float>(wx) - origin_x) * zoom)),
+                              offset_y + static_cast<int>(std::floor((static_cast<float>(wy) - origin_y) * zoom)));
+        indices[count] = static_cast<std::uint32_t>(i);
+        count += visible;
+    }
+    return count;
+}
+
+std::size_t Camera2D::transform_visible(std::span<const Rect> world, std::span<Rect> screen,
+                                        std::span<std::uint32_t> indices) const noexcept
+{
+    const int view_x1 = m_viewport.get_x();
+    const int view_y1 = m_viewport.get_y();
+    const int view_x2 = m_viewport.get_x2();
+    const int view_y2 = m_viewport.get_y2();
+    const float origin_x = static_cast<float>(view_x1);
+    const float origin_y = static_cast<float>(view_y1);
+    const int offset_x = m_offset.get_x();
+    const int offset_y = m_offset.get_y();
+    const float zoom = m_zoom;
+
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < world.size(); ++i)
+    {
+        Rect const& rect = world[i];
+        const int wx1 = rect.get_x();
+        const int wy1 = rect.get_y();
+        const int wx2 = wx1 + rect.get_width();
+        const int wy2 = wy1 + rect.get_height();
+        const bool visible = (wx2 > view_x1) & (wx1 <= view_x2) & (wy2 > view_y1) & (wy1 <= view_y2);
+
+        const int x1 = static_cast<int>(std::floor((static_cast<float>(wx1) - origin_x) * zoom));
+        const int y1 = static_cast<int>(std::floor((static_cast<float>(wy1) - origin_y) * zoom));
+        const int x2 = static_cast<int>(std::floor((static_cast<float>(wx2) - origin_x) * zoom));
+        const int y2 = static_cast<int>(std::floor((static_cast<float>(wy2) - origin_y) * zoom));
+        screen[count] = Rect(offset_x + x1, offset_y + y1, x2 - x1, y2 - y1);
+        indices[count] = static_cast<std::uint32_t>(i);
+        count += visible;
+    }
+    return count;
+}
+
+}
@@ -0,0 +1,126 @@
+#include <cstddef>
+#include <new>
+#include <SDL3pp/CoroutineFramePool.hpp>
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+// A free block stores the link to the next one in its first bytes
+struct FreeBlock
+{
+    FreeBlock* next;
+};
+
+struct Cache
+{
+    Cache() = default;
+
+    Cache(Cache const&) = delete;
+    Cache& operator=(Cache const&) = delete;
+
+    ~Cache()
+    {
+        for (FreeBlock*& head : free_lists)
+        {
+            while (head != nullptr)
+            {
+                FreeBlock* const next = head->next;
+                ::operator delete(static_cast<void*>(head));
+                head = next;
+            }
+        }
+    }
+
+    FreeBlock* free_lists[CoroutineFramePool::class_count] {};
+    std::size_t free_counts[CoroutineFramePool::class_count] {};
+    CoroutineFramePoolStats stats;
+};
+
+std::size_t get_max_cached_blocks(std::size_t size_class) noexcept
+{
+    return CoroutineFramePool::max_cached_bytes / ((size_class + 1) * CoroutineFramePool::granularity);
+}
+
+Cache& get_cache() noexcept
+{
+    thread_local Cache cache;
+    return cache;
+}
+
+}
+
+void* CoroutineFramePool::allocate(std::size_t size)
+{
+    Cache& cache = get_cache();
+    ++cache.stats.allocations;
+    const std::size_t size_class = get_size_class(size);
+    if (size_class < class_count)
+    {
+        FreeBlock* const block = cache.free_lists[size_class];
+        if (block != nullptr)
+        {
+            cache.free_lists[size_class] = block->next;
+            --cache.free_counts[size_class];
+            --cache.stats.cached_blocks;
+            ++cache.stats.recycled_allocations;
+            return block;
+        }
+        // Allocate the whole class, so the block fits any frame of the class
+        size = (size_class + 1) * granularity;
+    }
+    ++cache.stats.heap_allocations;
+    return ::operator new(size);
+}
+
+void CoroutineFramePool::deallocate(void* frame, std::size_t size) noexcept
+{
+    if (frame == nullptr)
+        return;
+    Cache& cache = get_cache();
+    const std::size_t size_class = get_size_class(size);
+    if (size_class >= class_count || cache.free_counts[size_class] >= get_max_cached_blocks(size_class))
+    {
+        ::operator delete(frame);
+        return;
+    }
+    auto* const block = ::new (frame) FreeBlock {cache.free_lists[size_class]};
+    cache.free_lists[size_class] = block;
+    ++cache.free_counts[size_class];
+    ++cache.stats.cached_blocks;
+}
+
+void CoroutineFramePool::reserve(std::size_t size, std::size_t count)
+{
+    const std::size_t size_class = get_size_class(size);
+    if (size_class >= class_count)
+        return;
+    Cache& cache = get_cache();
+    if (count > get_max_cached_blocks(size_class))
+        count = get_max_cached_blocks(size_class);
+    while (cache.free_counts[size_class] < count)
+    {
+        void* const frame = ::operator new((size_class + 1) * granularity);
+        ++cache.stats.heap_allocations;
+        cache.free_lists[size_class] = ::new (frame) FreeBlock {cache.free_lists[size_class]};
+        ++cache.free_counts[size_class];
+        ++cache.stats.cached_blocks;
+    }
+}
+
+CoroutineFramePoolStats CoroutineFramePool::get_stats() noexcept
+{
+    return get_cache().stats;
+}
+
+void CoroutineFramePool::reset_stats() noexcept
+{
+    CoroutineFramePoolStats& stats = get_cache().stats;
+    const std::size_t cached_blocks = stats.cached_blocks;
+    stats = {};
+    stats.cached_blocks = cached_blocks;
+}
+
+}
@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+#include <SDL3/SDL_events.h>
+#include <SDL3/SDL_version.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/EventCoalescer.hpp>
+#include <SDL3pp/Exception.hpp>
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+// Whether two events of a merged type come from the same window, mouse and direction
+bool is_same_stream(SDL_Event const& a, SDL_Event const& b) noexcept
+{
+    if (a.type != b.type)
+        return false;
+    if (a.type == SDL_EVENT_MOUSE_MOTION)
+        return a.motion.windowID == b.motion.windowID && a.motion.which == b.motion.which;
+    return a.wheel.windowID == b.wheel.windowID && a.wheel.which == b.wheel.which
+        && a.wheel.direction == b.wheel.direction;
+}
+
+}
+
+EventCoalescer::EventCoalescer(EventCoalescerConfig const& config)
+ : m_config(config),
+   m_stats(),
+   m_events(),
+   m_runs()
+{}
+
+std::size_t EventCoalescer::pump()
+{
+    SDL3PP_CALL(SDL_PumpEvents);
+    if (!m_config.mouse_motion && !m_config.mouse_wheel)
+        return 0;
+
+    // Nothing to merge without two events in the range of the merged types
+    const Uint32 first = m_config.mouse_motion ? SDL_EVENT_MOUSE_MOTION : SDL_EVENT_MOUSE_WHEEL;
+    const Uint32 last = m_config.mouse_wheel ? SDL_EVENT_MOUSE_WHEEL : SDL_EVENT_MOUSE_MOTION;
+    if (SDL3PP_CALL(SDL_PeepEvents, nullptr, 0, SDL_PEEKEVENT, first, last) < 2)
+        return 0;
+
+    const int count = SDL3PP_CALL(SDL_PeepEvents, nullptr, 0, SDL_PEEKEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    if (count < 0)
+    {
+        throw Exception("SDL_PeepEvents");
+    }
+    m_events.resize(static_cast<std::size_t>(count));
+    const int taken = SDL3PP_CALL(SDL_PeepEvents, m_events.data(), count, SDL_GETEVENT, SDL_EVENT_FIRST,
+                                  SDL_EVENT_LAST);
+    if (taken < 0)
+    {
+        throw Exception("SDL_PeepEvents");
+    }
+    m_events.resize(static_cast<std::size_t>(taken));
+
+    // The events are compacted in place, the merged ones at the place of the first of their run
+    std::size_t dropped_motions = 0;
+    std::size_t dropped_wheels = 0;
+    std::size_t kept = 0;
+    m_runs.clear();
+    for (SDL_Event const& event : m_events)
+    {
+        if (!is_merged(event.type))
+        {
+            // Anything else ends the runs, to keep the order of the clicks and the motions
+            m_runs.clear();
+            m_events[kept++] = event;
+            continue;
+        }
+
+        const auto run = std::find_if(m_runs.begin(), m_runs.end(), [&](Run const& candidate) {
+            return is_same_stream(m_events[candidate.index], event);
+        });
+        const bool motion = event.type == SDL_EVENT_MOUSE_MOTION;
+        if (run == m_runs.end())
+        {
+            if (motion)
+                m_runs.push_back({kept, event.motion.xrel, event.motion.yrel});
+            else
+                m_runs.push_back({kept, event.wheel.x, event.wheel.y});
+            m_events[kept++] = event;
+            continue;
+        }
+
+        SDL_Event& merged = m_events[run->index];
+        if (motion)
+        {
+            run->x += static_cast<double>(event.motion.xrel);
+            run->y += static_cast<double>(event.motion.yrel);
+            merged = event;
+            merged.motion.xrel = static_cast<float>(run->x);
+            merged.motion.yrel = static_cast<float>(run->y);
+            ++dropped_motions;
+        }
+        else
+        {
+            run->x += static_cast<double>(event.wheel.x);
+            run->y += static_cast<double>(event.wheel.y);
+#if SDL_VERSION_ATLEAST(3, 2, 12)
+            const Sint32 integer_x = merged.wheel.integer_x + event.wheel.integer_x;
+            const Sint32 integer_y = merged.wheel.integer_y + event.wheel.integer_y;
+#endif
+            merged = event;
+            merged.wheel.x = static_cast<float>(run->x);
+            merged.wheel.y = static_cast<float>(run->y);
+#if SDL_VERSION_ATLEAST(3, 2, 12)
+            merged.wheel.integer_x = integer_x;
+            merged.wheel.integer_y = integer_y;
+#endif
+            ++dropped_wheels;
+        }
+    }
+
+    const int added = SDL3PP_CALL(SDL_PeepEvents, m_events.data(), static_cast<int>(kept), SDL_ADDEVENT,
+                                  SDL_EVENT_FIRST, SDL_EVENT_LAST);
+    if (added != static_cast<int>(kept))
+    {
+        throw Exception("SDL_PeepEvents");
+    }
+
+    m_stats.dropped_motion_events += dropped_motions;
+    m_stats.dropped_wheel_events += dropped_wheels;
+    if (dropped_motions + dropped_wheels != 0)
+        ++m_stats.coalesced_pumps;
+    return dropped_motions + dropped_wheels;
+}
+
+bool EventCoalescer::is_merged(Uint32 type) const noexcept
+{
+    return (type == SDL_EVENT_MOUSE_MOTION && m_config.mouse_motion)
+        || (type == SDL_EVENT_MOUSE_WHEEL && m_config.mouse_wheel);
+}
+
+}
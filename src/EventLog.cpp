@@ -0,0 +1,474 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <span>
+#include <string>
+#include <vector>
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_events.h>
+#include <SDL3/SDL_iostream.h>
+#include <SDL3/SDL_timer.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/EventLog.hpp>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/MemoryTracker.hpp>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+constexpr char log_magic[8] = {'S', 'D', 'L', '3', 'P', 'P', 'E', 'V'};
+constexpr Uint32 log_version = 1;
+
+struct FileHeader
+{
+    char magic[8];
+    Uint32 version;
+    Uint32 event_size;
+};
+
+struct RecordHeader
+{
+    Uint64 time_ns;
+    Uint16 event_size;
+    std::array<Uint16, 2> string_sizes;
+    Uint16 reserved;
+};
+
+static_assert(sizeof(FileHeader) == 16);
+static_assert(sizeof(RecordHeader) == 16);
+static_assert(sizeof(SDL_Event) <= std::numeric_limits<Uint16>::max());
+
+// The string fields of an event, in the order of the record
+std::array<const char**, 2> get_strings(SDL_Event& event) noexcept
+{
+    switch (event.type)
+    {
+    case SDL_EVENT_TEXT_EDITING:
+        return {&event.edit.text, nullptr};
+    case SDL_EVENT_TEXT_INPUT:
+        return {&event.text.text, nullptr};
+    case SDL_EVENT_DROP_BEGIN:
+    case SDL_EVENT_DROP_FILE:
+    case SDL_EVENT_DROP_TEXT:
+    case SDL_EVENT_DROP_COMPLETE:
+    case SDL_EVENT_DROP_POSITION:
+        return {&event.drop.source, &event.drop.data};
+    default:
+        return {nullptr, nullptr};
+    }
+}
+
+// Clears the pointers which are not strings, meaningless in another process
+void clear_pointers(SDL_Event& event) noexcept
+{
+    if (event.type == SDL_EVENT_TEXT_EDITING_CANDIDATES)
+    {
+        event.edit_candidates.candidates = nullptr;
+        event.edit_candidates.num_candidates = 0;
+    }
+    else if (event.type == SDL_EVENT_CLIPBOARD_UPDATE)
+    {
+        event.clipboard.mime_types = nullptr;
+        event.clipboard.num_mime_types = 0;
+    }
+    else if (event.type >= SDL_EVENT_USER && event.type <= SDL_EVENT_LAST)
+    {
+        event.user.data1 = nullptr;
+        event.user.data2 = nullptr;
+    }
+}
+
+/**
+ * Parse the record at an offset of the log, returns its size, or zero for
+ * a truncated or invalid record, which ends the log.
+ */
+std::size_t parse_record(std::span<const std::byte> log, std::size_t offset, RecordHeader& header) noexcept
+{
+    if (log.size() - offset < sizeof(RecordHeader))
+        return 0;
+    std::memcpy(&header, log.data() + offset, sizeof(header));
+    if (header.event_size > sizeof(SDL_Event))
+        return 0;
+    std::size_t size = sizeof(RecordHeader) + header.event_size;
+    for (const Uint16 string_size : header.string_sizes)
+    {
+        size += string_size;
+        if (log.size() - offset < size)
+            return 0;
+        if (string_size != 0 && log[offset + size - 1] != std::byte {0})
+            return 0;
+    }
+    return log.size() - offset < size ? 0 : size;
+}
+
+[[noreturn]] void fail(const char* reason)
+{
+    SDL_SetError("Invalid event log: %s", reason);
+    throw Exception("EventPlayer::EventPlayer");
+}
+
+#ifdef _WIN32
+std::span<const std::byte> map_file(std::string const& file)
+{
+    const int length = MultiByteToWideChar(CP_UTF8, 0, file.c_str(), -1, nullptr, 0);
+    std::wstring path(static_cast<std::size_t>(std::max(length, 1)), L'\0');
+    MultiByteToWideChar(CP_UTF8, 0, file.c_str(), -1, path.data(), length);
+    const HANDLE handle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                      FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (handle == INVALID_HANDLE_VALUE)
+    {
+        SDL_SetError("Couldn't open %s", file.c_str());
+        throw Exception("EventPlayer::EventPlayer");
+    }
+    LARGE_INTEGER size {};
+    if (!GetFileSizeEx(handle, &size) || size.QuadPart < static_cast<LONGLONG>(sizeof(FileHeader)))
+    {
+        CloseHandle(handle);
+        fail("truncated header");
+    }
+    // The view keeps the mapping and the file open
+    const HANDLE mapping = CreateFileMappingW(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(handle);
+    void* const data = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (mapping != nullptr)
+        CloseHandle(mapping);
+    if (data == nullptr)
+    {
+        SDL_SetError("Couldn't map %s", file.c_str());
+        throw Exception("EventPlayer::EventPlayer");
+    }
+    return {static_cast<const std::byte*>(data), static_cast<std::size_t>(size.QuadPart)};
+}
+
+void unmap_file(std::span<const std::byte> log) noexcept
+{
+    UnmapViewOfFile(log.data());
+}
+#else
+std::span<const std::byte> map_file(std::string const& file)
+{
+    const int descriptor = open(file.c_str(), O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0)
+    {
+        SDL_SetError("Couldn't open %s: %s", file.c_str(), std::strerror(errno));
+        throw Exception("EventPlayer::EventPlayer");
+    }
+    struct stat info {};
+    if (fstat(descriptor, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(FileHeader)))
+    {
+        close(descriptor);
+        fail("truncated header");
+    }
+    const auto size = static_cast<std::size_t>(info.st_size);
+    // The mapping keeps the file open
+    void* const data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor);
+    if (data == MAP_FAILED)
+    {
+        SDL_SetError("Couldn't map %s: %s", file.c_str(), std::strerror(errno));
+        throw Exception("EventPlayer::EventPlayer");
+    }
+    // The records are read once, in order
+    static_cast<void>(posix_madvise(data, size, POSIX_MADV_SEQUENTIAL));
+    return {static_cast<const std::byte*>(data), size};
+}
+
+void unmap_file(std::span<const std::byte> log) noexcept
+{
+    munmap(const_cast<std::byte*>(log.data()), log.size());
+}
+#endif
+
+}
+
+EventRecorder::EventRecorder(std::string const& file)
+ : m_stream(),
+   m_mutex(),
+   m_buffer(),
+   m_origin(0),
+   m_recording(false),
+   m_write_failed(false),
+   m_stats()
+{
+    {
+        const MemoryScope scope(MemoryTag::io);
+        m_stream.reset(SDL3PP_CALL(SDL_IOFromFile, file.c_str(), "wb"));
+    }
+    if (m_stream == nullptr)
+    {
+        throw Exception("SDL_IOFromFile");
+    }
+    FileHeader header {};
+    std::memcpy(header.magic, log_magic, sizeof(log_magic));
+    header.version = log_version;
+    header.event_size = sizeof(SDL_Event);
+    if (SDL3PP_CALL(SDL_WriteIO, m_stream.get(), &header, sizeof(header)) != sizeof(header))
+    {
+        throw Exception("SDL_WriteIO");
+    }
+    m_buffer.reserve(buffer_size);
+}
+
+EventRecorder::~EventRecorder()
+{
+    if (m_recording)
+        SDL3PP_CALL(SDL_RemoveEventWatch, &on_event, this);
+    std::lock_guard lock(m_mutex);
+    static_cast<void>(write_buffer());
+}
+
+void EventRecorder::start()
+{
+    if (m_recording)
+        return;
+    {
+        std::lock_guard lock(m_mutex);
+        m_origin = SDL3PP_CALL(SDL_GetTicksNS);
+    }
+    if (!SDL3PP_CALL(SDL_AddEventWatch, &on_event, this))
+    {
+        throw Exception("SDL_AddEventWatch");
+    }
+    m_recording = true;
+}
+
+void EventRecorder::stop()
+{
+    if (m_recording)
+    {
+        SDL3PP_CALL(SDL_RemoveEventWatch, &on_event, this);
+        m_recording = false;
+    }
+    flush();
+}
+
+void EventRecorder::record(SDL_Event const& event)
+{
+    std::lock_guard lock(m_mutex);
+    append(event);
+    if (m_write_failed)
+    {
+        m_write_failed = false;
+        throw Exception("SDL_WriteIO");
+    }
+}
+
+void EventRecorder::flush()
+{
+    std::lock_guard lock(m_mutex);
+    const bool written = write_buffer();
+    if (m_write_failed || !written)
+    {
+        m_write_failed = false;
+        if (written)
+            SDL_SetError("Couldn't write the records of the event watch");
+        throw Exception("SDL_WriteIO");
+    }
+    if (!SDL3PP_CALL(SDL_FlushIO, m_stream.get()))
+    {
+        throw Exception("SDL_FlushIO");
+    }
+}
+
+EventRecorderStats EventRecorder::get_stats() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_stats;
+}
+
+bool SDLCALL EventRecorder::on_event(void* userdata, SDL_Event* event)
+{
+    auto* const recorder = static_cast<EventRecorder*>(userdata);
+    // Only the growth of the buffer throws, on exhausted memory: the event is lost
+    try
+    {
+        std::lock_guard lock(recorder->m_mutex);
+        recorder->append(*event);
+    }
+    catch (...)
+    {
+    }
+    return true;
+}
+
+void EventRecorder::append(SDL_Event const& event)
+{
+    if (event.type == SDL_EVENT_POLL_SENTINEL)
+        return;
+
+    SDL_Event copy;
+    std::memcpy(&copy, &event, sizeof(copy));
+    const Uint64 timestamp = copy.common.timestamp != 0 ? copy.common.timestamp : SDL3PP_CALL(SDL_GetTicksNS);
+
+    RecordHeader header {};
+    header.time_ns = timestamp - std::min(timestamp, m_origin);
+    std::array<const char*, 2> strings {};
+    const std::array<const char**, 2> fields = get_strings(copy);
+    for (std::size_t i = 0; i < fields.size(); ++i)
+    {
+        if (fields[i] == nullptr || *fields[i] == nullptr)
+            continue;
+        strings[i] = *fields[i];
+        *fields[i] = nullptr;
+        const std::size_t size = std::strlen(strings[i]) + 1;
+        if (size > std::numeric_limits<Uint16>::max())
+            ++m_stats.truncated_strings;
+        header.string_sizes[i] = static_cast<Uint16>(std::min<std::size_t>(size, std::numeric_limits<Uint16>::max()));
+    }
+    clear_pointers(copy);
+
+    // Most events are much smaller than the union
+    const auto* const bytes = reinterpret_cast<const std::byte*>(&copy);
+    std::size_t event_size = sizeof(copy);
+    while (event_size > 0 && bytes[event_size - 1] == std::byte {0})
+        --event_size;
+    header.event_size = static_cast<Uint16>(event_size);
+
+    const std::size_t start = m_buffer.size();
+    m_buffer.resize(start + sizeof(header) + event_size + header.string_sizes[0] + header.string_sizes[1]);
+    std::byte* out = m_buffer.data() + start;
+    std::memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+    std::memcpy(out, bytes, event_size);
+    out += event_size;
+    for (std::size_t i = 0; i < strings.size(); ++i)
+    {
+        const std::size_t size = header.string_sizes[i];
+        if (size == 0)
+            continue;
+        // A truncated string keeps its terminating null character
+        std::memcpy(out, strings[i], size - 1);
+        out[size - 1] = std::byte {0};
+        out += size;
+    }
+
+    ++m_stats.recorded_events;
+    m_stats.recorded_bytes += m_buffer.size() - start;
+    if (m_buffer.size() >= buffer_size && !write_buffer())
+        m_write_failed = true;
+}
+
+bool EventRecorder::write_buffer() noexcept
+{
+    if (m_buffer.empty())
+        return true;
+    const bool written = SDL3PP_CALL(SDL_WriteIO, m_stream.get(), m_buffer.data(), m_buffer.size()) == m_buffer.size();
+    m_buffer.clear();
+    return written;
+}
+
+EventPlayer::EventPlayer(std::string const& file, PlaybackMode mode)
+ : m_log(map_file(file)),
+   m_end(sizeof(FileHeader)),
+   m_cursor(sizeof(FileHeader)),
+   m_event_count(0),
+   m_duration_ns(0),
+   m_start(0),
+   m_started(false),
+   m_mode(mode),
+   m_stats()
+{
+    try
+    {
+        FileHeader header {};
+        std::memcpy(&header, m_log.data(), sizeof(header));
+        if (std::memcmp(header.magic, log_magic, sizeof(log_magic)) != 0)
+            fail("not an event log");
+        if (header.version != log_version)
+            fail("unsupported version");
+        if (header.event_size != sizeof(SDL_Event))
+            fail("recorded with another version of SDL");
+    }
+    catch (...)
+    {
+        unmap_file(m_log);
+        throw;
+    }
+
+    RecordHeader header {};
+    while (const std::size_t size = parse_record(m_log, m_end, header))
+    {
+        m_end += size;
+        ++m_event_count;
+        m_duration_ns = std::max(m_duration_ns, header.time_ns);
+    }
+}
+
+EventPlayer::~EventPlayer()
+{
+    unmap_file(m_log);
+}
+
+std::size_t EventPlayer::update(std::size_t batch) noexcept
+{
+    const Uint64 now = SDL3PP_CALL(SDL_GetTicksNS);
+    if (!m_started)
+    {
+        m_start = now;
+        m_started = true;
+    }
+    const Uint64 elapsed = now - m_start;
+
+    std::size_t pushed = 0;
+    for (std::size_t count = 0; count < batch && m_cursor < m_end; ++count)
+    {
+        RecordHeader header {};
+        const std::size_t size = parse_record(m_log, m_cursor, header);
+        if (m_mode == PlaybackMode::real_time && header.time_ns > elapsed)
+            break;
+
+        SDL_Event event;
+        std::memset(&event, 0, sizeof(event));
+        const std::byte* data = m_log.data() + m_cursor + sizeof(header);
+        std::memcpy(&event, data, header.event_size);
+        data += header.event_size;
+        // Stamped by SDL_PushEvent()
+        event.common.timestamp = 0;
+        const std::array<const char**, 2> fields = get_strings(event);
+        for (std::size_t i = 0; i < fields.size(); ++i)
+        {
+            if (fields[i] != nullptr)
+                *fields[i] = header.string_sizes[i] != 0 ? reinterpret_cast<const char*>(data) : nullptr;
+            data += header.string_sizes[i];
+        }
+        m_cursor += size;
+
+        if (SDL3PP_CALL(SDL_PushEvent, &event))
+            ++pushed;
+        else
+            ++m_stats.rejected_events;
+    }
+    m_stats.pushed_events += pushed;
+    return pushed;
+}
+
+void EventPlayer::rewind() noexcept
+{
+    m_cursor = sizeof(FileHeader);
+    m_started = false;
+}
+
+}
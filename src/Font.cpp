@@ -0,0 +1,72 @@
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <SDL3_ttf/SDL_ttf.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/Font.hpp>
+#include <SDL3pp/MemoryTracker.hpp>
+
+namespace SDL3pp
+{
+
+Font::Font(std::string const& file, float size)
+ : m_font(), m_id(next_id())
+{
+    const MemoryScope scope(MemoryTag::text);
+    m_font.reset(SDL3PP_CALL(TTF_OpenFont, file.c_str(), size));
+    if (m_font == nullptr)
+    {
+        throw Exception("TTF_OpenFont");
+    }
+}
+
+GlyphMetrics Font::get_glyph_metrics(std::uint32_t glyph) const
+{
+    GlyphMetrics metrics;
+    if (!SDL3PP_CALL(TTF_GetGlyphMetrics, get(), glyph, &metrics.min_x, &metrics.max_x,
+                     &metrics.min_y, &metrics.max_y, &metrics.advance))
+    {
+        throw Exception("TTF_GetGlyphMetrics");
+    }
+    return metrics;
+}
+
+int Font::get_kerning(std::uint32_t previous, std::uint32_t glyph) const noexcept
+{
+    int kerning = 0;
+    if (!SDL3PP_CALL(TTF_GetGlyphKerning, get(), previous, glyph, &kerning))
+        return 0;
+    return kerning;
+}
+
+Surface Font::render_glyph(std::uint32_t glyph, Color const& color) const
+{
+    const MemoryScope scope(MemoryTag::text);
+    SDL_Surface* surface = SDL3PP_CALL(TTF_RenderGlyph_Blended, get(), glyph, color);
+    if (surface == nullptr)
+    {
+        throw Exception("TTF_RenderGlyph_Blended");
+    }
+    return Surface(surface);
+}
+
+Surface Font::render_text(std::string_view text, Color const& color) const
+{
+    const MemoryScope scope(MemoryTag::text);
+    SDL_Surface* surface = SDL3PP_CALL(TTF_RenderText_Blended, get(), text.data(), text.size(), color);
+    if (surface == nullptr)
+    {
+        throw Exception("TTF_RenderText_Blended");
+    }
+    return Surface(surface);
+}
+
+std::uint32_t Font::next_id() noexcept
+{
+    static std::atomic<std::uint32_t> id {0};
+    return ++id;
+}
+
+}
@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <SDL3pp/FrameArena.hpp>
+
+namespace SDL3pp
+{
+
+FrameArena::FrameArena(std::size_t capacity, std::pmr::memory_resource* upstream)
+ : m_upstream(upstream)
+{
+    for (Buffer& buffer : m_buffers)
+    {
+        if (capacity > 0)
+            buffer.data = static_cast<std::byte*>(m_upstream->allocate(capacity, alignof(std::max_align_t)));
+        buffer.capacity = capacity;
+        buffer.cursor = buffer.data;
+        buffer.end = buffer.data + capacity;
+    }
+}
+
+FrameArena::~FrameArena()
+{
+    for (Buffer& buffer : m_buffers)
+    {
+        while (Block* block = buffer.overflow)
+        {
+            buffer.overflow = block->next;
+            m_upstream->deallocate(block, sizeof(Block) + block->size, alignof(std::max_align_t));
+        }
+        if (buffer.data != nullptr)
+            m_upstream->deallocate(buffer.data, buffer.capacity, alignof(std::max_align_t));
+    }
+}
+
+void FrameArena::next_frame()
+{
+    rewind(m_buffers[m_current ^ 1]);
+    m_current ^= 1;
+    ++m_stats.frames;
+}
+
+FrameArenaStats FrameArena::get_stats() const noexcept
+{
+    return m_stats;
+}
+
+void FrameArena::reset_stats() noexcept
+{
+    m_stats = {};
+}
+
+void* FrameArena::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+    Buffer& buffer = m_buffers[m_current];
+    ++m_stats.allocations;
+    void* pointer = buffer.cursor;
+    std::size_t space = static_cast<std::size_t>(buffer.end - buffer.cursor);
+    if (buffer.cursor == nullptr || std::align(alignment, bytes, pointer, space) == nullptr)
+        return allocate_overflow(buffer, bytes, alignment);
+
+    std::byte* const next = static_cast<std::byte*>(pointer) + bytes;
+    buffer.used += static_cast<std::size_t>(next - buffer.cursor);
+    buffer.cursor = next;
+    m_stats.peak_bytes = std::max(m_stats.peak_bytes, buffer.used);
+    return pointer;
+}
+
+void FrameArena::do_deallocate(void*, std::size_t, std::size_t)
+{
+    // Released all at once by next_frame()
+}
+
+bool FrameArena::do_is_equal(std::pmr::memory_resource const& other) const noexcept
+{
+    return this == &other;
+}
+
+void FrameArena::rewind(Buffer& buffer)
+{
+    if (buffer.overflow != nullptr)
+    {
+        // Grow the buffer to hold the whole frame next time, allocated
+        // before anything is freed so that a failure leaves the buffer as it was
+        const std::size_t capacity = std::bit_ceil(buffer.used);
+        std::byte* const data = static_cast<std::byte*>(m_upstream->allocate(capacity, alignof(std::max_align_t)));
+        while (Block* block = buffer.overflow)
+        {
+            buffer.overflow = block->next;
+            m_upstream->deallocate(block, sizeof(Block) + block->size, alignof(std::max_align_t));
+        }
+        if (buffer.data != nullptr)
+            m_upstream->deallocate(buffer.data, buffer.capacity, alignof(std::max_align_t));
+        buffer.data = data;
+        buffer.capacity = capacity;
+    }
+    buffer.cursor = buffer.data;
+    buffer.end = buffer.data + buffer.capacity;
+    buffer.used = 0;
+}
+
+void* FrameArena::allocate_overflow(Buffer& buffer, std::size_t bytes, std::size_t alignment)
+{
+    // Geometric growth, as the frame has already used at least that much
+    const std::size_t size = std::max({buffer.capacity, buffer.used, bytes + alignment});
+    void* const memory = m_upstream->allocate(sizeof(Block) + size, alignof(std::max_align_t));
+    buffer.overflow = ::new (memory) Block {buffer.overflow, size};
+    ++m_stats.overflow_blocks;
+
+    // The rest of the previous range is lost for this frame
+    std::byte* const start = static_cast<std::byte*>(memory) + sizeof(Block);
+    void* pointer = start;
+    std::size_t space = size;
+    std::align(alignment, bytes, pointer, space);
+    std::byte* const next = static_cast<std::byte*>(pointer) + bytes;
+    buffer.used += static_cast<std::size_t>(next - start);
+    buffer.cursor = next;
+    buffer.end = start + size;
+    m_stats.peak_bytes = std::max(m_stats.peak_bytes, buffer.used);
+    return pointer;
+}
+
+}
@@ -0,0 +1,253 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/GlyphCache.hpp>
+#include <SDL3pp/Profiler.hpp>
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+// Glyphs are stored as RGBA32, so the alpha is the fourth byte of a pixel
+// whatever the endianness.
+constexpr PixelFormat page_format = SDL_PIXELFORMAT_RGBA32;
+constexpr int bytes_per_pixel = 4;
+constexpr int alpha_byte = 3;
+
+// Transparent border around each glyph, so linear filtering never samples
+// a neighbour.
+constexpr int padding = 1;
+
+}
+
+std::size_t GlyphCache::KeyHash::operator()(Key const& key) const noexcept
+{
+    std::size_t seed = std::hash<std::uint32_t>()(key.font);
+    seed ^= std::hash<std::uint32_t>()(key.glyph) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= std::hash<float>()(key.size) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    seed ^= std::hash<FontStyle>()(key.style) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
+GlyphCache::GlyphCache(Renderer& renderer, int page_size, std::size_t max_pages)
+ : m_renderer(&renderer),
+   m_page_size(page_size),
+   m_max_pages(max_pages)
+{}
+
+GlyphCache::Glyph const& GlyphCache::get_glyph(Font const& font, std::uint32_t glyph)
+{
+    return lookup(font, Key{font.get_id(), glyph, font.get_size(), font.get_style()});
+}
+
+Point GlyphCache::draw_text(SpriteBatch& batch, Font const& font, std::string_view text, Point const& position,
+                            Color const& color, std::uint16_t layer)
+{
+    Key key{font.get_id(), 0, font.get_size(), font.get_style()};
+    const int line_skip = font.get_line_skip();
+    Point pen = position;
+    std::uint32_t previous = 0;
+
+    const char* next = text.data();
+    std::size_t left = text.size();
+    while (left > 0)
+    {
+        key.glyph = SDL_StepUTF8(&next, &left);
+        if (key.glyph == '\n')
+        {
+            pen = Point(position.get_x(), pen.get_y() + line_skip);
+            previous = 0;
+            continue;
+        }
+        if (previous != 0)
+            pen.set_x(pen.get_x() + font.get_kerning(previous, key.glyph));
+        previous = key.glyph;
+
+        Glyph const& glyph = lookup(font, key);
+        if (glyph.src.get_width() > 0)
+        {
+            batch.draw(m_pages[glyph.page].texture, glyph.src,
+                       Rect(pen + glyph.offset, glyph.src.get_width(), glyph.src.get_height()),
+                       layer, SDL_BLENDMODE_BLEND, color);
+            ++m_stats.glyphs_drawn;
+        }
+        pen.set_x(pen.get_x() + glyph.advance);
+    }
+    return pen;
+}
+
+void GlyphCache::clear() noexcept
+{
+    m_glyphs.clear();
+    for (Page& page : m_pages)
+    {
+        page.shelves.clear();
+        page.bottom = 0;
+        page.keys.clear();
+    }
+}
+
+GlyphCache::Glyph const& GlyphCache::lookup(Font const& font, Key const& key)
+{
+    const auto it = m_glyphs.find(key);
+    if (it != m_glyphs.end())
+    {
+        ++m_stats.hits;
+        if (it->second.src.get_width() > 0)
+            m_pages[it->second.page].last_used = m_frame;
+        return it->second;
+    }
+
+    ++m_stats.misses;
+    const Glyph glyph = rasterize(font, key);
+    if (glyph.src.get_width() > 0)
+        m_pages[glyph.page].keys.push_back(key);
+    return m_glyphs.emplace(key, glyph).first->second;
+}
+
+GlyphCache::Glyph GlyphCache::rasterize(Font const& font, Key const& key)
+{
+    SDL3PP_ZONE("GlyphCache::rasterize");
+    Glyph glyph;
+    glyph.advance = font.get_glyph_metrics(key.glyph).advance;
+
+    Surface rendered = font.render_glyph(key.glyph, Color{255, 255, 255, 255});
+    if (rendered.get_format() != page_format)
+        rendered = rendered.convert(page_format);
+
+    // Trim the one glyph line to the visible pixels
+    const auto* pixels = static_cast<const unsigned char*>(rendered.get_pixels());
+    const int pitch = rendered.get_pitch();
+    int min_x = rendered.get_width();
+    int max_x = -1;
+    int min_y = rendered.get_height();
+    int max_y = -1;
+    for (int y = 0; y < rendered.get_height(); ++y)
+    {
+        const unsigned char* row = pixels + static_cast<std::ptrdiff_t>(y) * pitch;
+        for (int x = 0; x < rendered.get_width(); ++x)
+        {
+            if (row[x * bytes_per_pixel + alpha_byte] == 0)
+                continue;
+            min_x = std::min(min_x, x);
+            max_x = std::max(max_x, x);
+            min_y = std::min(min_y, y);
+            max_y = y;
+        }
+    }
+    if (max_x < 0)
+        return glyph;
+
+    const int w = max_x - min_x + 1;
+    const int h = max_y - min_y + 1;
+    const int padded_w = w + 2 * padding;
+    const int padded_h = h + 2 * padding;
+    Point position;
+    glyph.page = allocate(padded_w, padded_h, position);
+
+    m_scratch.assign(static_cast<std::size_t>(padded_w) * static_cast<std::size_t>(padded_h), 0);
+    for (int y = 0; y < h; ++y)
+    {
+        std::memcpy(&m_scratch[static_cast<std::size_t>((y + padding) * padded_w + padding)],
+                    pixels + static_cast<std::ptrdiff_t>(min_y + y) * pitch + min_x * bytes_per_pixel,
+                    static_cast<std::size_t>(w * bytes_per_pixel));
+    }
+    m_pages[glyph.page].texture.update(Rect(position, padded_w, padded_h), m_scratch.data(),
+                                       padded_w * bytes_per_pixel);
+
+    glyph.src = Rect(position.get_x() + padding, position.get_y() + padding, w, h);
+    glyph.offset = Point(min_x, min_y);
+    return glyph;
+}
+
+std::size_t GlyphCache::allocate(int w, int h, Point& position)
+{
+    if (w > m_page_size || h > m_page_size)
+    {
+        SDL_SetError("A glyph of %dx%d pixels does not fit in %dx%d atlas pages", w, h, m_page_size, m_page_size);
+        throw Exception("GlyphCache::get_glyph");
+    }
+
+    // The most recent pages are the most likely to have room left
+    for (std::size_t page = m_pages.size(); page-- > 0;)
+    {
+        if (const std::optional<Point> found = allocate_in(m_pages[page], w, h))
+        {
+            position = *found;
+            m_pages[page].last_used = m_frame;
+            return page;
+        }
+    }
+
+    std::size_t page = m_pages.size();
+    if (m_pages.size() >= m_max_pages)
+    {
+        std::size_t oldest = 0;
+        for (std::size_t i = 1; i < m_pages.size(); ++i)
+        {
+            if (m_pages[i].last_used < m_pages[oldest].last_used)
+                oldest = i;
+        }
+        if (m_pages[oldest].last_used < m_frame)
+        {
+            evict(oldest);
+            page = oldest;
+        }
+    }
+    if (page == m_pages.size())
+    {
+        m_pages.push_back(Page{Texture(*m_renderer, page_format, SDL_TEXTUREACCESS_STATIC, m_page_size, m_page_size),
+                               {}, 0, {}, m_frame});
+        m_pages.back().texture.set_blend_mode(SDL_BLENDMODE_BLEND);
+    }
+
+    position = *allocate_in(m_pages[page], w, h);
+    m_pages[page].last_used = m_frame;
+    return page;
+}
+
+std::optional<Point> GlyphCache::allocate_in(Page& page, int w, int h) const noexcept
+{
+    // Best fit among the shelves, unless the glyph would waste more than half
+    // of the shelf and a new shelf can still be opened
+    Shelf* best = nullptr;
+    for (Shelf& shelf : page.shelves)
+    {
+        if (shelf.height >= h && shelf.x + w <= m_page_size && (best == nullptr || shelf.height < best->height))
+            best = &shelf;
+    }
+    if ((best == nullptr || best->height > 2 * h) && page.bottom + h <= m_page_size)
+    {
+        page.shelves.push_back(Shelf{0, page.bottom, h});
+        page.bottom += h;
+        best = &page.shelves.back();
+    }
+    if (best == nullptr)
+        return std::nullopt;
+
+    const Point position(best->x, best->y);
+    best->x += w;
+    return position;
+}
+
+void GlyphCache::evict(std::size_t page) noexcept
+{
+    for (Key const& key : m_pages[page].keys)
+        m_glyphs.erase(key);
+    m_pages[page].keys.clear();
+    m_pages[page].shelves.clear();
+    m_pages[page].bottom = 0;
+    ++m_stats.evicted_pages;
+}
+
+}
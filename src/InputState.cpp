@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <SDL3/SDL_keyboard.h>
+#include <SDL3/SDL_mouse.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/InputState.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define SDL3PP_INPUT_SSE2
+#elif defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#include <arm_neon.h>
+#define SDL3PP_INPUT_NEON
+#endif
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+#if defined(SDL3PP_INPUT_SSE2)
+// Unaligned loads and stores, through void pointers
+__m128i load(const void* source) noexcept
+{
+    return _mm_loadu_si128(static_cast<const __m128i*>(source));
+}
+
+void store(void* destination, __m128i value) noexcept
+{
+    _mm_storeu_si128(static_cast<__m128i*>(destination), value);
+}
+#endif
+
+/**
+ * Pack 64 bools into the bits of a word, 16 at a time: the bytes are
+ * compared with zero and their sign bits gathered.
+ */
+std::uint64_t pack_keys(const bool* keys) noexcept
+{
+    std::uint64_t word = 0;
+#if defined(SDL3PP_INPUT_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (std::size_t i = 0; i < 64; i += 16)
+    {
+        const __m128i bytes = load(keys + i);
+        const auto up = static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, zero)));
+        word |= static_cast<std::uint64_t>(~up & 0xFFFFu) << i;
+    }
+#elif defined(SDL3PP_INPUT_NEON)
+    // Each byte keeps the bit of its lane, then the halves are summed up
+    static constexpr std::uint8_t weights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    const uint8x16_t lanes = vld1q_u8(weights);
+    for (std::size_t i = 0; i < 64; i += 16)
+    {
+        const uint8x16_t bytes = vld1q_u8(reinterpret_cast<const std::uint8_t*>(keys + i));
+        const uint8x16_t bits = vandq_u8(vtstq_u8(bytes, bytes), lanes);
+        const auto low = static_cast<std::uint64_t>(vaddv_u8(vget_low_u8(bits)));
+        const auto high = static_cast<std::uint64_t>(vaddv_u8(vget_high_u8(bits)));
+        word |= (low | high << 8) << i;
+    }
+#else
+    for (std::size_t i = 0; i < 64; ++i)
+        word |= static_cast<std::uint64_t>(keys[i]) << i;
+#endif
+    return word;
+}
+
+/**
+ * Compute the pressed, released and held masks, two words at a time with
+ * SIMD instructions.
+ */
+void compute_edges(KeyMask const& keys, KeyMask const& previous,
+                   KeyMask& pressed, KeyMask& released, KeyMask& held) noexcept
+{
+    std::size_t i = 0;
+#if defined(SDL3PP_INPUT_SSE2)
+    for (; i + 2 <= KeyMask::word_count; i += 2)
+    {
+        const __m128i now = load(keys.words.data() + i);
+        const __m128i before = load(previous.words.data() + i);
+        store(pressed.words.data() + i, _mm_andnot_si128(before, now));
+        store(released.words.data() + i, _mm_andnot_si128(now, before));
+        store(held.words.data() + i, _mm_and_si128(now, before));
+    }
+#elif defined(SDL3PP_INPUT_NEON)
+    for (; i + 2 <= KeyMask::word_count; i += 2)
+    {
+        const uint64x2_t now = vld1q_u64(keys.words.data() + i);
+        const uint64x2_t before = vld1q_u64(previous.words.data() + i);
+        vst1q_u64(pressed.words.data() + i, vbicq_u64(now, before));
+        vst1q_u64(released.words.data() + i, vbicq_u64(before, now));
+        vst1q_u64(held.words.data() + i, vandq_u64(now, before));
+    }
+#endif
+    for (; i < KeyMask::word_count; ++i)
+    {
+        pressed.words[i] = keys.words[i] & ~previous.words[i];
+        released.words[i] = ~keys.words[i] & previous.words[i];
+        held.words[i] = keys.words[i] & previous.words[i];
+    }
+}
+
+}
+
+InputState::InputState() noexcept
+ : m_keyboard(),
+   m_keys(),
+   m_pressed(),
+   m_released(),
+   m_held(),
+   m_mouse_position(),
+   m_mouse_motion(),
+   m_buttons(0),
+   m_previous_buttons(0)
+{
+    int count = 0;
+    const bool* const keyboard = SDL3PP_CALL(SDL_GetKeyboardState, &count);
+    if (keyboard != nullptr && count > 0)
+        m_keyboard = std::span(keyboard, static_cast<std::size_t>(count));
+
+    // The motion of the first update starts from the current position
+    float x = 0.f;
+    float y = 0.f;
+    static_cast<void>(SDL3PP_CALL(SDL_GetMouseState, &x, &y));
+    m_mouse_position = Point(static_cast<int>(std::floor(x)), static_cast<int>(std::floor(y)));
+}
+
+void InputState::update() noexcept
+{
+    const KeyMask previous = m_keys;
+    const std::size_t size = std::min(m_keyboard.size(), key_count);
+    std::size_t word = 0;
+    for (; (word + 1) * 64 <= size; ++word)
+        m_keys.words[word] = pack_keys(m_keyboard.data() + word * 64);
+    if (word * 64 < size)
+    {
+        // Shorter keyboard state than the scancodes: the missing keys are up
+        bool tail[64] = {};
+        std::memcpy(tail, m_keyboard.data() + word * 64, size - word * 64);
+        m_keys.words[word++] = pack_keys(tail);
+    }
+    for (; word < KeyMask::word_count; ++word)
+        m_keys.words[word] = 0;
+    compute_edges(m_keys, previous, m_pressed, m_released, m_held);
+
+    float x = 0.f;
+    float y = 0.f;
+    m_previous_buttons = m_buttons;
+    m_buttons = SDL3PP_CALL(SDL_GetMouseState, &x, &y);
+    const Point position(static_cast<int>(std::floor(x)), static_cast<int>(std::floor(y)));
+    m_mouse_motion = position - m_mouse_position;
+    m_mouse_position = position;
+}
+
+}
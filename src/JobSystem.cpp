@@ -0,0 +1,345 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <SDL3/SDL_cpuinfo.h>
+#include <SDL3/SDL_error.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/JobSystem.hpp>
+#include <SDL3pp/Profiler.hpp>
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+// Jobs a worker can queue before running the next ones at once
+constexpr std::size_t deque_capacity = 4096;
+
+constexpr std::size_t no_worker = std::numeric_limits<std::size_t>::max();
+
+// Pool and index of the worker running on the calling thread
+thread_local const void* current_system = nullptr;
+thread_local std::size_t current_index = no_worker;
+
+// Start of the next steal attempts, spread so thieves do not all hit the
+// same victim
+thread_local std::uint32_t steal_seed = 0x9E3779B9u;
+
+std::mutex instance_mutex;
+JobSystemConfig instance_config;
+std::unique_ptr<JobSystem> instance;
+
+}
+
+JobSystem::JobSystem(JobSystemConfig config)
+ : m_workers(),
+   m_on_worker_start(std::move(config.on_worker_start)),
+   m_injected_mutex()
+{
+    std::size_t count = config.worker_count;
+    if (count == 0)
+        count = static_cast<std::size_t>(std::max(SDL3PP_CALL(SDL_GetNumLogicalCPUCores) - 1, 1));
+
+    m_workers.reserve(count);
+    for (std::size_t index = 0; index < count; ++index)
+        m_workers.push_back(std::make_unique<Worker>(deque_capacity));
+
+    // Start the threads once every deque exists, as thieves visit them all
+    try
+    {
+        for (std::size_t index = 0; index < count; ++index)
+            m_workers[index]->thread = std::thread(&JobSystem::run, this, index);
+    }
+    catch (...)
+    {
+        m_stop.store(true, std::memory_order_seq_cst);
+        m_signal.fetch_add(1, std::memory_order_seq_cst);
+        m_signal.notify_all();
+        for (auto& worker : m_workers)
+            if (worker->thread.joinable())
+                worker->thread.join();
+        throw;
+    }
+}
+
+JobSystem::~JobSystem()
+{
+    m_stop.store(true, std::memory_order_seq_cst);
+    m_signal.fetch_add(1, std::memory_order_seq_cst);
+    m_signal.notify_all();
+    for (auto& worker : m_workers)
+        worker->thread.join();
+
+    for (auto& worker : m_workers)
+        while (const auto job = worker->deque.pop())
+            delete *job;
+    while (Job* const job = m_injected_head)
+    {
+        m_injected_head = job->next;
+        delete job;
+    }
+}
+
+void JobSystem::configure(JobSystemConfig config)
+{
+    std::lock_guard lock(instance_mutex);
+    if (instance != nullptr)
+    {
+        SDL_SetError("The shared JobSystem is already started");
+        throw Exception("JobSystem::configure");
+    }
+    instance_config = std::move(config);
+}
+
+JobSystem& JobSystem::get_instance()
+{
+    std::lock_guard lock(instance_mutex);
+    if (instance == nullptr)
+        instance = std::make_unique<JobSystem>(instance_config);
+    return *instance;
+}
+
+void JobSystem::submit(std::function<void()> job, Counter* counter)
+{
+    // Allocated first, so that a failure leaves the counter as it was
+    Job* const pushed = new Job {std::move(job), nullptr, nullptr, 0, 0, counter, nullptr};
+    if (counter != nullptr)
+        counter->m_pending.fetch_add(2, std::memory_order_relaxed);
+    push(pushed);
+}
+
+void JobSystem::submit_after(Counter& dependency, std::function<void()> job, Counter* counter)
+{
+    Job* const continuation = new Job {std::move(job), nullptr, nullptr, 0, 0, counter, nullptr};
+    if (counter != nullptr)
+        counter->m_pending.fetch_add(2, std::memory_order_relaxed);
+    if (dependency.is_done())
+    {
+        push(continuation);
+        return;
+    }
+
+    Job* head = dependency.m_continuations.load(std::memory_order_relaxed);
+    do
+    {
+        continuation->next = head;
+    } while (!dependency.m_continuations.compare_exchange_weak(head, continuation, std::memory_order_release,
+                                                               std::memory_order_relaxed));
+
+    // The last job may have released the continuations before this one was
+    // linked: release it here then
+    if (dependency.m_pending.load(std::memory_order_acquire) <= 1)
+        release_continuations(dependency);
+}
+
+void JobSystem::wait(Counter& counter) noexcept
+{
+    const std::size_t index = is_worker_thread() ? current_index : no_worker;
+    while (!counter.is_done())
+    {
+        if (Job* const job = find_job(index))
+            execute(job);
+        else
+            std::this_thread::yield();
+    }
+}
+
+bool JobSystem::is_worker_thread() const noexcept
+{
+    return current_system == this;
+}
+
+JobSystemStats JobSystem::get_stats() const noexcept
+{
+    JobSystemStats stats;
+    stats.executed_jobs = m_external_executed_jobs.load(std::memory_order_relaxed);
+    for (auto const& worker : m_workers)
+    {
+        stats.executed_jobs += worker->executed_jobs.load(std::memory_order_relaxed);
+        stats.stolen_jobs += worker->stolen_jobs.load(std::memory_order_relaxed);
+        stats.inline_jobs += worker->inline_jobs.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+void JobSystem::submit_range(RangeFunction function, void* context, std::size_t begin, std::size_t end,
+                             Counter& counter)
+{
+    Job* const job = new Job {{}, function, context, begin, end, &counter, nullptr};
+    counter.m_pending.fetch_add(2, std::memory_order_relaxed);
+    push(job);
+}
+
+void JobSystem::push(Job* job) noexcept
+{
+    if (is_worker_thread())
+    {
+        Worker& worker = *m_workers[current_index];
+        if (!worker.deque.push(job))
+        {
+            worker.inline_jobs.fetch_add(1, std::memory_order_relaxed);
+            execute(job);
+            return;
+        }
+    }
+    else
+    {
+        std::lock_guard lock(m_injected_mutex);
+        if (m_injected_tail != nullptr)
+            m_injected_tail->next = job;
+        else
+            m_injected_head = job;
+        m_injected_tail = job;
+        m_injected_count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Paired with run(): either the worker sees the new signal, or this
+    // sees it sleeping
+    m_signal.fetch_add(1, std::memory_order_seq_cst);
+    if (m_sleeping.load(std::memory_order_seq_cst) > 0)
+        m_signal.notify_one();
+}
+
+JobSystem::Job* JobSystem::find_job(std::size_t index) noexcept
+{
+    if (index != no_worker)
+    {
+        if (const auto job = m_workers[index]->deque.pop())
+            return *job;
+    }
+
+    if (m_injected_count.load(std::memory_order_relaxed) > 0)
+    {
+        std::lock_guard lock(m_injected_mutex);
+        if (Job* const job = m_injected_head)
+        {
+            m_injected_head = job->next;
+            if (m_injected_head == nullptr)
+                m_injected_tail = nullptr;
+            job->next = nullptr;
+            m_injected_count.fetch_sub(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+
+    steal_seed ^= steal_seed << 13;
+    steal_seed ^= steal_seed >> 17;
+    steal_seed ^= steal_seed << 5;
+    const std::size_t count = m_workers.size();
+    const std::size_t start = steal_seed % count;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::size_t victim = (start + i) % count;
+        if (victim == index)
+            continue;
+        if (const auto job = m_workers[victim]->deque.steal())
+        {
+            if (index != no_worker)
+                m_workers[index]->stolen_jobs.fetch_add(1, std::memory_order_relaxed);
+            return *job;
+        }
+    }
+    return nullptr;
+}
+
+void JobSystem::execute(Job* job) noexcept
+{
+    SDL3PP_ZONE("JobSystem::execute");
+    if (job->range_function != nullptr)
+        job->range_function(job->context, job->begin, job->end);
+    else
+        job->function();
+    Counter* const counter = job->counter;
+    delete job;
+
+    if (is_worker_thread())
+        m_workers[current_index]->executed_jobs.fetch_add(1, std::memory_order_relaxed);
+    else
+        m_external_executed_jobs.fetch_add(1, std::memory_order_relaxed);
+    finish(counter);
+}
+
+void JobSystem::finish(Counter* counter) noexcept
+{
+    if (counter == nullptr)
+        return;
+
+    // Each job counts 2: the last one goes through 1 while it releases the
+    // continuations, so a waiter can not destroy the counter under it. Jobs
+    // submitted meanwhile add 2 to that 1, which the last job takes back
+    // without losing them: one of them is then the last job.
+    std::size_t pending = counter->m_pending.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        if (pending == 2)
+        {
+            if (counter->m_pending.compare_exchange_weak(pending, 1, std::memory_order_acq_rel,
+                                                         std::memory_order_relaxed))
+            {
+                release_continuations(*counter);
+                // Not touched after that, it may be destroyed once done
+                counter->m_pending.fetch_sub(1, std::memory_order_acq_rel);
+                return;
+            }
+        }
+        else if (pending % 2 != 0)
+        {
+            // Another job is releasing the continuations: ending before it
+            // would leave the continuations linked meanwhile to nobody
+            std::this_thread::yield();
+            pending = counter->m_pending.load(std::memory_order_relaxed);
+        }
+        else if (counter->m_pending.compare_exchange_weak(pending, pending - 2, std::memory_order_acq_rel,
+                                                          std::memory_order_relaxed))
+        {
+            return;
+        }
+    }
+}
+
+void JobSystem::release_continuations(Counter& counter) noexcept
+{
+    Job* job = counter.m_continuations.exchange(nullptr, std::memory_order_acquire);
+    while (job != nullptr)
+    {
+        Job* const next = job->next;
+        job->next = nullptr;
+        push(job);
+        job = next;
+    }
+}
+
+void JobSystem::run(std::size_t index) noexcept
+{
+    current_system = this;
+    current_index = index;
+    steal_seed += static_cast<std::uint32_t>(index) * 0x632BE5ABu;
+    if (m_on_worker_start)
+        m_on_worker_start(index);
+
+    while (!m_stop.load(std::memory_order_acquire))
+    {
+        const std::uint32_t signal = m_signal.load(std::memory_order_seq_cst);
+        if (Job* const job = find_job(index))
+        {
+            execute(job);
+            continue;
+        }
+
+        m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+        if (!m_stop.load(std::memory_order_acquire) && m_signal.load(std::memory_order_seq_cst) == signal)
+            m_signal.wait(signal, std::memory_order_seq_cst);
+        m_sleeping.fetch_sub(1, std::memory_order_seq_cst);
+    }
+}
+
+}
@@ -0,0 +1,151 @@
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <SDL3/SDL_init.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/MainThreadQueue.hpp>
+
+namespace SDL3pp
+{
+
+MainThreadQueue::MainThreadQueue(std::size_t capacity)
+ : m_slots(std::make_unique<Slot[]>(std::bit_ceil(std::max<std::size_t>(capacity, 2)))),
+   m_mask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1)
+{
+    // A slot is free for the producer of index i when its sequence is i,
+    // and ready for the consumer when it is i + 1
+    for (std::size_t index = 0; index <= m_mask; ++index)
+        m_slots[index].sequence.store(index, std::memory_order_relaxed);
+}
+
+MainThreadQueue::~MainThreadQueue() = default;
+
+std::size_t MainThreadQueue::drain() noexcept
+{
+    // Stop at the tasks posted before the call, as tasks may post others
+    std::size_t head = m_head.load(std::memory_order_relaxed);
+    const std::size_t end = m_tail.load(std::memory_order_acquire);
+    std::size_t executed = 0;
+    while (head != end)
+    {
+        Slot& slot = m_slots[head & m_mask];
+        // A claimed slot may not be published yet: leave it to the next call
+        if (slot.sequence.load(std::memory_order_acquire) != head + 1)
+            break;
+        slot.task();
+        slot.task.reset();
+        slot.sequence.store(head + m_mask + 1, std::memory_order_release);
+        ++head;
+        ++executed;
+    }
+    if (executed == 0)
+        return 0;
+
+    // Paired with push(): either a waiting producer sees the new head, or
+    // this sees the producer waiting
+    m_head.store(head, std::memory_order_seq_cst);
+    if (m_waiting_producers.load(std::memory_order_seq_cst) > 0)
+        m_head.notify_all();
+    m_executed_tasks.fetch_add(executed, std::memory_order_relaxed);
+    return executed;
+}
+
+void MainThreadQueue::set_sdl_dispatch(bool enabled) noexcept
+{
+    m_sdl_dispatch.store(enabled, std::memory_order_relaxed);
+    if (enabled && get_size() > 0)
+        request_dispatch();
+}
+
+MainThreadQueueStats MainThreadQueue::get_stats() const noexcept
+{
+    MainThreadQueueStats stats;
+    stats.posted_tasks = m_posted_tasks.load(std::memory_order_relaxed);
+    stats.executed_tasks = m_executed_tasks.load(std::memory_order_relaxed);
+    stats.full_waits = m_full_waits.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void MainThreadQueue::push(Task&& task)
+{
+    if (!try_push(task))
+    {
+        m_full_waits.fetch_add(1, std::memory_order_relaxed);
+        // The main thread would wait for itself
+        if (SDL3PP_CALL(SDL_IsMainThread))
+        {
+            task();
+            m_posted_tasks.fetch_add(1, std::memory_order_relaxed);
+            m_executed_tasks.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        if (m_sdl_dispatch.load(std::memory_order_relaxed))
+            request_dispatch();
+
+        // Sleep until the main thread drains, rather than spinning against
+        // the other producers
+        m_waiting_producers.fetch_add(1, std::memory_order_seq_cst);
+        for (;;)
+        {
+            const std::size_t head = m_head.load(std::memory_order_seq_cst);
+            if (try_push(task))
+                break;
+            m_head.wait(head, std::memory_order_seq_cst);
+        }
+        m_waiting_producers.fetch_sub(1, std::memory_order_relaxed);
+    }
+    m_posted_tasks.fetch_add(1, std::memory_order_relaxed);
+    if (m_sdl_dispatch.load(std::memory_order_relaxed))
+        request_dispatch();
+}
+
+bool MainThreadQueue::try_push(Task& task) noexcept
+{
+    std::size_t tail = m_tail.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        Slot& slot = m_slots[tail & m_mask];
+        const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        const auto distance = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(tail);
+        if (distance == 0)
+        {
+            if (m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+            {
+                slot.task = std::move(task);
+                slot.sequence.store(tail + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (distance < 0)
+        {
+            // The slot still holds the task of the previous lap
+            return false;
+        }
+        else
+        {
+            tail = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+void MainThreadQueue::request_dispatch() noexcept
+{
+    if (m_dispatch_pending.exchange(true, std::memory_order_acq_rel))
+        return;
+    if (!SDL3PP_CALL(SDL_RunOnMainThread, &MainThreadQueue::on_dispatch, this, false))
+        m_dispatch_pending.store(false, std::memory_order_release);
+}
+
+void SDLCALL MainThreadQueue::on_dispatch(void* userdata)
+{
+    auto* const queue = static_cast<MainThreadQueue*>(userdata);
+    // Cleared first, so a post racing with the drain requests another one
+    queue->m_dispatch_pending.store(false, std::memory_order_release);
+    queue->drain();
+}
+
+}
@@ -0,0 +1,419 @@
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_timer.h>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/MemoryTracker.hpp>
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+// Prefix of each block allocated through the hooks, keeping the alignment
+// of the original allocator
+struct alignas(std::max_align_t) Header
+{
+    std::size_t size;
+    MemoryTag tag;
+};
+
+using TagCounters = std::array<std::atomic<std::size_t>, memory_tag_count>;
+
+struct Counters
+{
+    TagCounters allocations {};
+    TagCounters frees {};
+    TagCounters allocated_bytes {};
+    TagCounters freed_bytes {};
+};
+
+// Counters written by their thread only, read by get_stats()
+struct ThreadCounters : Counters
+{
+    ThreadCounters* next = nullptr;
+};
+
+struct Registry
+{
+    std::mutex mutex;
+    ThreadCounters* threads = nullptr;
+    // Counters of the threads which have exited
+    Counters retired;
+
+    // The total is followed exactly, the tags at each sum of the counters
+    std::atomic<std::size_t> total_live_bytes {0};
+    std::atomic<std::size_t> total_peak_bytes {0};
+    TagCounters peak_bytes {};
+
+    std::atomic<std::size_t> frame_start {0};
+    std::atomic<std::size_t> frame_allocations {0};
+    std::atomic<double> allocation_rate {0.};
+    Uint64 frame_ticks = 0;
+
+    SDL_malloc_func malloc = nullptr;
+    SDL_calloc_func calloc = nullptr;
+    SDL_realloc_func realloc = nullptr;
+    SDL_free_func free = nullptr;
+    std::atomic<bool> installed {false};
+};
+
+// Never destroyed, as SDL may free memory after the static destructors
+Registry& get_registry() noexcept
+{
+    static Registry* const registry = new Registry;
+    return *registry;
+}
+
+enum class ThreadState : std::uint8_t
+{
+    fresh,
+    active,
+    retired
+};
+
+thread_local MemoryTag current_tag = MemoryTag::general;
+thread_local ThreadState thread_state = ThreadState::fresh;
+// Trivially destructible, for an access without the guard of thread_slot
+thread_local ThreadCounters* thread_counters = nullptr;
+
+void retire(std::atomic<std::size_t>& retired, std::atomic<std::size_t> const& counter) noexcept
+{
+    retired.fetch_add(counter.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+// Folds the counters of the thread into the retired ones when it exits
+struct ThreadSlot
+{
+    ThreadSlot() = default;
+
+    ThreadSlot(ThreadSlot const&) = delete;
+    ThreadSlot& operator=(ThreadSlot const&) = delete;
+
+    ~ThreadSlot()
+    {
+        thread_state = ThreadState::retired;
+        thread_counters = nullptr;
+        if (counters == nullptr)
+            return;
+        Registry& registry = get_registry();
+        std::lock_guard lock(registry.mutex);
+        for (std::size_t tag = 0; tag < memory_tag_count; ++tag)
+        {
+            retire(registry.retired.allocations[tag], counters->allocations[tag]);
+            retire(registry.retired.frees[tag], counters->frees[tag]);
+            retire(registry.retired.allocated_bytes[tag], counters->allocated_bytes[tag]);
+            retire(registry.retired.freed_bytes[tag], counters->freed_bytes[tag]);
+        }
+        ThreadCounters** link = &registry.threads;
+        while (*link != counters)
+            link = &(*link)->next;
+        *link = counters->next;
+        delete counters;
+    }
+
+    ThreadCounters* counters = nullptr;
+};
+
+thread_local ThreadSlot thread_slot;
+
+// nullptr once the thread is exiting
+ThreadCounters* get_thread_counters() noexcept
+{
+    if (thread_state == ThreadState::active)
+        return thread_counters;
+    if (thread_state == ThreadState::retired)
+        return nullptr;
+
+    auto* const counters = new (std::nothrow) ThreadCounters;
+    if (counters == nullptr)
+        return nullptr;
+    Registry& registry = get_registry();
+    {
+        std::lock_guard lock(registry.mutex);
+        counters->next = registry.threads;
+        registry.threads = counters;
+    }
+    thread_slot.counters = counters;
+    thread_counters = counters;
+    thread_state = ThreadState::active;
+    return counters;
+}
+
+// The owner is the only writer: no read-modify-write needed
+void add(std::atomic<std::size_t>& counter, std::size_t value) noexcept
+{
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+void update_peak(std::atomic<std::size_t>& peak, std::size_t live) noexcept
+{
+    std::size_t current = peak.load(std::memory_order_relaxed);
+    while (live > current && !peak.compare_exchange_weak(current, live, std::memory_order_relaxed))
+    {
+    }
+}
+
+void count_allocation(MemoryTag tag, std::size_t size) noexcept
+{
+    Registry& registry = get_registry();
+    const auto index = static_cast<std::size_t>(tag);
+    if (ThreadCounters* const counters = get_thread_counters())
+    {
+        add(counters->allocations[index], 1);
+        add(counters->allocated_bytes[index], size);
+    }
+    else
+    {
+        registry.retired.allocations[index].fetch_add(1, std::memory_order_relaxed);
+        registry.retired.allocated_bytes[index].fetch_add(size, std::memory_order_relaxed);
+    }
+    const std::size_t live = registry.total_live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    update_peak(registry.total_peak_bytes, live);
+}
+
+void count_free(MemoryTag tag, std::size_t size) noexcept
+{
+    Registry& registry = get_registry();
+    const auto index = static_cast<std::size_t>(tag);
+    if (ThreadCounters* const counters = get_thread_counters())
+    {
+        add(counters->frees[index], 1);
+        add(counters->freed_bytes[index], size);
+    }
+    else
+    {
+        registry.retired.frees[index].fetch_add(1, std::memory_order_relaxed);
+        registry.retired.freed_bytes[index].fetch_add(size, std::memory_order_relaxed);
+    }
+    registry.total_live_bytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+void* to_user(void* block) noexcept
+{
+    return static_cast<Header*>(block) + 1;
+}
+
+Header* to_header(void* memory) noexcept
+{
+    return static_cast<Header*>(memory) - 1;
+}
+
+void* SDLCALL tracked_malloc(std::size_t size)
+{
+    if (size > SIZE_MAX - sizeof(Header))
+        return nullptr;
+    void* const block = get_registry().malloc(sizeof(Header) + size);
+    if (block == nullptr)
+        return nullptr;
+    const MemoryTag tag = current_tag;
+    ::new (block) Header {size, tag};
+    count_allocation(tag, size);
+    return to_user(block);
+}
+
+void* SDLCALL tracked_calloc(std::size_t count, std::size_t size)
+{
+    if (size != 0 && count > (SIZE_MAX - sizeof(Header)) / size)
+        return nullptr;
+    const std::size_t bytes = count * size;
+    void* const block = get_registry().calloc(1, sizeof(Header) + bytes);
+    if (block == nullptr)
+        return nullptr;
+    const MemoryTag tag = current_tag;
+    ::new (block) Header {bytes, tag};
+    count_allocation(tag, bytes);
+    return to_user(block);
+}
+
+void* SDLCALL tracked_realloc(void* memory, std::size_t size)
+{
+    if (memory == nullptr)
+        return tracked_malloc(size);
+    if (size > SIZE_MAX - sizeof(Header))
+        return nullptr;
+    // The block stays charged to the tag of its first allocation
+    Header* const header = to_header(memory);
+    const Header previous = *header;
+    void* const block = get_registry().realloc(header, sizeof(Header) + size);
+    if (block == nullptr)
+        return nullptr;
+    static_cast<Header*>(block)->size = size;
+    count_free(previous.tag, previous.size);
+    count_allocation(previous.tag, size);
+    return to_user(block);
+}
+
+void SDLCALL tracked_free(void* memory)
+{
+    if (memory == nullptr)
+        return;
+    Header* const header = to_header(memory);
+    count_free(header->tag, header->size);
+    get_registry().free(header);
+}
+
+// Resource of get_resource(), accounted without a header as the size is
+// given back on deallocation
+class TrackedResource : public std::pmr::memory_resource
+{
+protected:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        void* const memory = ::operator new(bytes, std::align_val_t {alignment});
+        count_allocation(current_tag, bytes);
+        return memory;
+    }
+
+    void do_deallocate(void* memory, std::size_t bytes, std::size_t alignment) override
+    {
+        // The tag of the deallocating scope, which is not always the one of
+        // the allocation
+        count_free(current_tag, bytes);
+        ::operator delete(memory, bytes, std::align_val_t {alignment});
+    }
+
+    bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+// Sums the counters of every thread, and updates the peaks of the tags
+std::array<MemoryTagStats, memory_tag_count> sum_counters(Registry& registry) noexcept
+{
+    std::array<MemoryTagStats, memory_tag_count> tags;
+    std::array<std::size_t, memory_tag_count> freed_bytes {};
+    const auto accumulate = [&](Counters const& counters) {
+        for (std::size_t tag = 0; tag < memory_tag_count; ++tag)
+        {
+            tags[tag].allocations += counters.allocations[tag].load(std::memory_order_relaxed);
+            tags[tag].frees += counters.frees[tag].load(std::memory_order_relaxed);
+            tags[tag].live_bytes += counters.allocated_bytes[tag].load(std::memory_order_relaxed);
+            freed_bytes[tag] += counters.freed_bytes[tag].load(std::memory_order_relaxed);
+        }
+    };
+    {
+        std::lock_guard lock(registry.mutex);
+        accumulate(registry.retired);
+        for (ThreadCounters* counters = registry.threads; counters != nullptr; counters = counters->next)
+            accumulate(*counters);
+    }
+    for (std::size_t tag = 0; tag < memory_tag_count; ++tag)
+    {
+        // Another thread may have freed a block it has not counted yet
+        tags[tag].live_bytes = tags[tag].live_bytes > freed_bytes[tag] ? tags[tag].live_bytes - freed_bytes[tag] : 0;
+        update_peak(registry.peak_bytes[tag], tags[tag].live_bytes);
+        tags[tag].peak_bytes = registry.peak_bytes[tag].load(std::memory_order_relaxed);
+    }
+    return tags;
+}
+
+std::size_t sum_allocations(std::array<MemoryTagStats, memory_tag_count> const& tags) noexcept
+{
+    std::size_t allocations = 0;
+    for (MemoryTagStats const& tag : tags)
+        allocations += tag.allocations;
+    return allocations;
+}
+
+}
+
+void MemoryTracker::install()
+{
+    Registry& registry = get_registry();
+    if (registry.installed.load(std::memory_order_acquire))
+        return;
+    SDL_GetOriginalMemoryFunctions(&registry.malloc, &registry.calloc, &registry.realloc, &registry.free);
+    if (!SDL_SetMemoryFunctions(&tracked_malloc, &tracked_calloc, &tracked_realloc, &tracked_free))
+    {
+        throw Exception("SDL_SetMemoryFunctions");
+    }
+    registry.frame_ticks = SDL_GetTicksNS();
+    registry.installed.store(true, std::memory_order_release);
+}
+
+bool MemoryTracker::is_installed() noexcept
+{
+    return get_registry().installed.load(std::memory_order_acquire);
+}
+
+std::pmr::memory_resource* MemoryTracker::get_resource() noexcept
+{
+    static TrackedResource resource;
+    return &resource;
+}
+
+MemoryStats MemoryTracker::get_stats() noexcept
+{
+    Registry& registry = get_registry();
+    MemoryStats stats;
+    stats.tags = sum_counters(registry);
+    for (MemoryTagStats const& tag : stats.tags)
+    {
+        stats.total.allocations += tag.allocations;
+        stats.total.frees += tag.frees;
+    }
+    stats.total.live_bytes = registry.total_live_bytes.load(std::memory_order_relaxed);
+    stats.total.peak_bytes = registry.total_peak_bytes.load(std::memory_order_relaxed);
+    stats.frame_allocations = registry.frame_allocations.load(std::memory_order_relaxed);
+    stats.allocation_rate = registry.allocation_rate.load(std::memory_order_relaxed);
+    return stats;
+}
+
+std::size_t MemoryTracker::get_frame_allocations() noexcept
+{
+    Registry& registry = get_registry();
+    return sum_allocations(sum_counters(registry)) - registry.frame_start.load(std::memory_order_relaxed);
+}
+
+void MemoryTracker::next_frame() noexcept
+{
+    Registry& registry = get_registry();
+    const std::size_t allocations = sum_allocations(sum_counters(registry));
+    const std::size_t frame_allocations = allocations - registry.frame_start.load(std::memory_order_relaxed);
+    registry.frame_start.store(allocations, std::memory_order_relaxed);
+    registry.frame_allocations.store(frame_allocations, std::memory_order_relaxed);
+
+    const Uint64 ticks = SDL_GetTicksNS();
+    if (ticks > registry.frame_ticks)
+    {
+        const double seconds = static_cast<double>(ticks - registry.frame_ticks) / 1e9;
+        registry.allocation_rate.store(static_cast<double>(frame_allocations) / seconds, std::memory_order_relaxed);
+    }
+    registry.frame_ticks = ticks;
+}
+
+void MemoryTracker::reset_peaks() noexcept
+{
+    Registry& registry = get_registry();
+    for (std::atomic<std::size_t>& peak : registry.peak_bytes)
+        peak.store(0, std::memory_order_relaxed);
+    sum_counters(registry);
+    registry.total_peak_bytes.store(registry.total_live_bytes.load(std::memory_order_relaxed),
+                                    std::memory_order_relaxed);
+}
+
+MemoryScope::MemoryScope(MemoryTag tag) noexcept
+ : m_previous(current_tag)
+{
+    current_tag = tag;
+}
+
+MemoryScope::~MemoryScope()
+{
+    current_tag = m_previous;
+}
+
+MemoryTag MemoryScope::get_current() noexcept
+{
+    return current_tag;
+}
+
+}
@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+#include <SDL3pp/MusicStream.hpp>
+
+namespace SDL3pp
+{
+
+MusicStream::MusicStream(std::unique_ptr<AudioDecoder> decoder, std::size_t prefetch_frames,
+                         std::size_t chunk_frames, bool loop, JobSystem& jobs)
+ : m_decoder(std::move(decoder)),
+   m_channels(m_decoder->get_channels()),
+   m_frequency(m_decoder->get_frequency()),
+   m_chunk_frames(chunk_frames),
+   m_loop(loop),
+   m_ring(std::max(prefetch_frames, chunk_frames) * static_cast<std::size_t>(m_channels)),
+   m_decode_chunk(std::make_unique<float[]>(chunk_frames * static_cast<std::size_t>(m_channels))),
+   m_feed_chunk(std::make_unique<float[]>(chunk_frames * static_cast<std::size_t>(m_channels))),
+   m_start(std::chrono::steady_clock::now()),
+   m_jobs(jobs),
+   m_decoding_job()
+{
+    schedule_decode();
+}
+
+MusicStream::~MusicStream()
+{
+    m_stop.store(true, std::memory_order_release);
+    m_jobs.wait(m_decoding_job);
+}
+
+std::size_t MusicStream::read(std::span<float> samples) noexcept
+{
+    const auto channels = static_cast<std::size_t>(m_channels);
+    const std::size_t frames = samples.size() / channels;
+    const std::size_t read = m_ring.read(samples.first(frames * channels)) / channels;
+    if (read > 0)
+        m_read_frames.fetch_add(read, std::memory_order_relaxed);
+    // Also retries a decode which could not be scheduled, even with an empty ring
+    if (!m_decoding.load(std::memory_order_relaxed) && m_ring.get_free() >= m_chunk_frames * channels
+        && !m_end.load(std::memory_order_acquire))
+        schedule_decode();
+    if (read < frames && m_time_to_first_sample.load(std::memory_order_relaxed) != 0
+        && !m_end.load(std::memory_order_acquire))
+        m_underruns.fetch_add(1, std::memory_order_relaxed);
+    return read;
+}
+
+std::size_t MusicStream::feed(AudioStream& stream) noexcept
+{
+    const auto channels = static_cast<std::size_t>(m_channels);
+    std::size_t moved = 0;
+    for (;;)
+    {
+        const std::size_t frames = std::min(m_chunk_frames, stream.get_writable_frames());
+        if (frames == 0)
+            break;
+        const std::size_t read = this->read(std::span<float>(m_feed_chunk.get(), frames * channels));
+        moved += stream.write(std::span<const float>(m_feed_chunk.get(), read * channels));
+        if (read < frames)
+            break;
+    }
+    return moved;
+}
+
+MusicStreamStats MusicStream::get_stats() const noexcept
+{
+    MusicStreamStats stats;
+    stats.decoded_frames = m_decoded_frames.load(std::memory_order_relaxed);
+    stats.read_frames = m_read_frames.load(std::memory_order_relaxed);
+    stats.underruns = m_underruns.load(std::memory_order_relaxed);
+    stats.time_to_first_sample = std::chrono::nanoseconds(m_time_to_first_sample.load(std::memory_order_relaxed));
+    stats.resident_bytes = (m_ring.get_capacity() + 2 * m_chunk_frames * static_cast<std::size_t>(m_channels))
+                         * sizeof(float);
+    return stats;
+}
+
+void MusicStream::schedule_decode() noexcept
+{
+    if (m_decoding.exchange(true, std::memory_order_acq_rel))
+        return;
+    // Submitting allocates the job: on exhausted memory, the next read tries again
+    try
+    {
+        m_jobs.submit([this] { decode(); }, &m_decoding_job);
+    }
+    catch (...)
+    {
+        m_decoding.store(false, std::memory_order_release);
+    }
+}
+
+void MusicStream::decode() noexcept
+{
+    const std::size_t chunk_size = m_chunk_frames * static_cast<std::size_t>(m_channels);
+    for (;;)
+    {
+        while (!m_stop.load(std::memory_order_acquire) && !m_end.load(std::memory_order_relaxed)
+               && m_ring.get_free() >= chunk_size)
+        {
+            const std::size_t frames = m_decoder->decode(std::span<float>(m_decode_chunk.get(), chunk_size));
+            if (frames == 0)
+            {
+                // A track which decodes nothing right after a rewind would spin
+                if (m_loop && !m_rewound && m_decoder->rewind())
+                {
+                    m_rewound = true;
+                    continue;
+                }
+                m_end.store(true, std::memory_order_release);
+                break;
+            }
+            m_rewound = false;
+
+            m_ring.write(std::span<const float>(m_decode_chunk.get(), frames * static_cast<std::size_t>(m_channels)));
+            m_decoded_frames.fetch_add(frames, std::memory_order_relaxed);
+            if (m_time_to_first_sample.load(std::memory_order_relaxed) == 0)
+            {
+                const std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - m_start;
+                m_time_to_first_sample.store(std::max<std::int64_t>(elapsed.count(), 1), std::memory_order_release);
+            }
+        }
+
+        m_decoding.store(false, std::memory_order_release);
+        // A read may have freed room between the last check and the release
+        // of the flag, without scheduling a job since this one was running
+        if (m_stop.load(std::memory_order_acquire) || m_end.load(std::memory_order_relaxed)
+            || m_ring.get_free() < chunk_size || m_decoding.exchange(true, std::memory_order_acq_rel))
+            return;
+    }
+}
+
+}
@@ -0,0 +1,270 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <SDL3/SDL_iostream.h>
+#include <SDL3/SDL_timer.h>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/Profiler.hpp>
+#include <SDL3pp/SpscRing.hpp>
+#include <SDL3pp/unique_handle.hpp>
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+struct ThreadBuffer
+{
+    explicit ThreadBuffer(std::uint32_t id)
+     : ring(Profiler::ring_capacity),
+       thread(id)
+    {}
+
+    // Written by its thread, read by the collector
+    SpscRing<ProfileEvent> ring;
+    std::atomic<bool> exited {false};
+    std::uint32_t thread;
+};
+
+struct Registry
+{
+    // Also serializes the collections, the only consumer of the rings
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    std::uint32_t next_thread = 0;
+    // Indexed by thread, kept after the exit of the thread
+    std::vector<std::string> thread_names;
+};
+
+// Time zero of the traces, the start of the earliest recorded zone: nothing
+// is measured until a zone is recorded
+std::atomic<Uint64> trace_origin {std::numeric_limits<Uint64>::max()};
+
+// Events lost by every thread to a full ring, rare enough to share a counter
+std::atomic<std::size_t> dropped_events {0};
+
+// Never destroyed, as detached threads may record zones at exit
+Registry& get_registry()
+{
+    static Registry* const registry = new Registry;
+    return *registry;
+}
+
+enum class ThreadState : std::uint8_t
+{
+    fresh,
+    active,
+    exited
+};
+
+thread_local ThreadState thread_state = ThreadState::fresh;
+thread_local ThreadBuffer* thread_buffer = nullptr;
+
+// Hands the buffer over to the registry when the thread exits
+struct ThreadSlot
+{
+    ThreadSlot() = default;
+
+    ThreadSlot(ThreadSlot const&) = delete;
+    ThreadSlot& operator=(ThreadSlot const&) = delete;
+
+    ~ThreadSlot()
+    {
+        thread_state = ThreadState::exited;
+        if (thread_buffer != nullptr)
+            thread_buffer->exited.store(true, std::memory_order_release);
+        thread_buffer = nullptr;
+    }
+};
+
+thread_local ThreadSlot thread_slot;
+
+ThreadBuffer* get_thread_buffer()
+{
+    if (thread_state == ThreadState::active)
+        return thread_buffer;
+    if (thread_state == ThreadState::exited)
+        return nullptr;
+
+    Registry& registry = get_registry();
+    std::lock_guard lock(registry.mutex);
+    registry.buffers.push_back(std::make_unique<ThreadBuffer>(registry.next_thread++));
+    registry.thread_names.emplace_back();
+    // Constructs the slot, whose destructor runs at the exit of the thread
+    static_cast<void>(thread_slot);
+    thread_buffer = registry.buffers.back().get();
+    thread_state = ThreadState::active;
+    return thread_buffer;
+}
+
+void append_escaped(std::string& json, std::string_view text)
+{
+    constexpr std::string_view digits = "0123456789abcdef";
+    for (const char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            json += '\\';
+            json += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            json += "\\u00";
+            json += digits[static_cast<unsigned char>(c) >> 4];
+            json += digits[static_cast<unsigned char>(c) & 0xF];
+        }
+        else
+        {
+            json += c;
+        }
+    }
+}
+
+// Microseconds with a nanosecond resolution, the unit of the trace format
+void append_microseconds(std::string& json, Uint64 ticks, Uint64 frequency)
+{
+    const double microseconds = static_cast<double>(ticks) * 1e6 / static_cast<double>(frequency);
+    std::array<char, 32> buffer;
+    const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), microseconds,
+                                      std::chars_format::fixed, 3);
+    json.append(buffer.data(), result.ptr);
+}
+
+}
+
+std::vector<ProfileEvent> Profiler::collect()
+{
+    Registry& registry = get_registry();
+    std::vector<ProfileEvent> events;
+    std::lock_guard lock(registry.mutex);
+    for (std::unique_ptr<ThreadBuffer>& buffer : registry.buffers)
+    {
+        // Read after the flag, so that an exited thread is drained entirely
+        const bool exited = buffer->exited.load(std::memory_order_acquire);
+        const std::size_t size = buffer->ring.get_size();
+        const std::size_t start = events.size();
+        events.resize(start + size);
+        events.resize(start + buffer->ring.read(std::span(events).subspan(start)));
+        if (exited)
+            buffer.reset();
+    }
+    std::erase(registry.buffers, nullptr);
+    return events;
+}
+
+void Profiler::write_chrome_trace(std::string const& file)
+{
+    const std::string json = to_chrome_trace(collect());
+    const unique_handle<SDL_IOStream, &SDL_CloseIO> stream(SDL_IOFromFile(file.c_str(), "wb"));
+    if (stream == nullptr)
+    {
+        throw Exception("SDL_IOFromFile");
+    }
+    if (SDL_WriteIO(stream.get(), json.data(), json.size()) != json.size())
+    {
+        throw Exception("SDL_WriteIO");
+    }
+}
+
+std::string Profiler::to_chrome_trace(std::vector<ProfileEvent> const& events)
+{
+    Registry& registry = get_registry();
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+    const Uint64 origin = trace_origin.load(std::memory_order_relaxed);
+    std::string json = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    const auto begin_event = [&] {
+        if (!first)
+            json += ',';
+        json += "\n{";
+        first = false;
+    };
+
+    {
+        std::lock_guard lock(registry.mutex);
+        for (std::size_t thread = 0; thread < registry.thread_names.size(); ++thread)
+        {
+            if (registry.thread_names[thread].empty())
+                continue;
+            begin_event();
+            json += "\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":";
+            json += std::to_string(thread);
+            json += ",\"args\":{\"name\":\"";
+            append_escaped(json, registry.thread_names[thread]);
+            json += "\"}}";
+        }
+    }
+
+    for (ProfileEvent const& event : events)
+    {
+        begin_event();
+        json += "\"name\":\"";
+        append_escaped(json, event.name);
+        json += "\",\"ph\":\"X\",\"pid\":1,\"tid\":";
+        json += std::to_string(event.thread);
+        json += ",\"ts\":";
+        append_microseconds(json, event.start - std::min(event.start, origin), frequency);
+        json += ",\"dur\":";
+        append_microseconds(json, event.end - event.start, frequency);
+        json += '}';
+    }
+    json += "\n]}\n";
+    return json;
+}
+
+void Profiler::set_thread_name(std::string name)
+{
+    ThreadBuffer* const buffer = get_thread_buffer();
+    if (buffer == nullptr)
+        return;
+    Registry& registry = get_registry();
+    std::lock_guard lock(registry.mutex);
+    registry.thread_names[buffer->thread] = std::move(name);
+}
+
+std::size_t Profiler::get_dropped_events() noexcept
+{
+    return dropped_events.load(std::memory_order_relaxed);
+}
+
+void Profiler::record(const char* name, Uint64 start, Uint64 end) noexcept
+{
+    ThreadBuffer* buffer = thread_buffer;
+    if (buffer == nullptr)
+    {
+        // The registration allocates, which only fails on exhausted memory
+        try
+        {
+            buffer = get_thread_buffer();
+        }
+        catch (...)
+        {
+            return;
+        }
+        if (buffer == nullptr)
+            return;
+    }
+
+    // Lowered by the zones enclosing the first ones, which end after them
+    Uint64 origin = trace_origin.load(std::memory_order_relaxed);
+    while (start < origin && !trace_origin.compare_exchange_weak(origin, start, std::memory_order_relaxed))
+    {
+    }
+    const ProfileEvent event {name, start, end, buffer->thread};
+    if (buffer->ring.write(std::span(&event, 1)) == 0)
+        dropped_events.fetch_add(1, std::memory_order_relaxed);
+}
+
+}
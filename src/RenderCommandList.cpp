@@ -0,0 +1,329 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <SDL3/SDL_render.h>
+#include <SDL3pp/Point.hpp>
+#include <SDL3pp/Profiler.hpp>
+#include <SDL3pp/Rect.hpp>
+#include <SDL3pp/RenderCommandList.hpp>
+#include <SDL3pp/Renderer.hpp>
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+Rect bounds_of(std::span<const Point> points) noexcept
+{
+    int x1 = points.front().get_x();
+    int y1 = points.front().get_y();
+    int x2 = x1;
+    int y2 = y1;
+    for (Point const& point : points.subspan(1))
+    {
+        x1 = std::min(x1, point.get_x());
+        y1 = std::min(y1, point.get_y());
+        x2 = std::max(x2, point.get_x());
+        y2 = std::max(y2, point.get_y());
+    }
+    return Rect::from_corners(x1, y1, x2, y2);
+}
+
+Rect bounds_of(std::span<const Rect> rects) noexcept
+{
+    Rect bounds = rects.front();
+    for (Rect const& rect : rects.subspan(1))
+        bounds.union_in_place(rect);
+    return bounds;
+}
+
+Rect bounds_of(std::span<const SDL_Vertex> vertices) noexcept
+{
+    float x1 = vertices.front().position.x;
+    float y1 = vertices.front().position.y;
+    float x2 = x1;
+    float y2 = y1;
+    for (SDL_Vertex const& vertex : vertices.subspan(1))
+    {
+        x1 = std::min(x1, vertex.position.x);
+        y1 = std::min(y1, vertex.position.y);
+        x2 = std::max(x2, vertex.position.x);
+        y2 = std::max(y2, vertex.position.y);
+    }
+    return Rect::from_corners(static_cast<int>(std::floor(x1)), static_cast<int>(std::floor(y1)),
+                              static_cast<int>(std::ceil(x2)), static_cast<int>(std::ceil(y2)));
+}
+
+bool same_color(Color const& a, Color const& b) noexcept
+{
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+}
+
+void RenderCommandList::clear() noexcept
+{
+    m_commands.clear();
+    m_points.clear();
+    m_rects.clear();
+    m_geometries.clear();
+    m_vertices.clear();
+    m_indices.clear();
+    m_textures.clear();
+    m_bounds = Rect();
+    m_has_bounds = false;
+}
+
+void RenderCommandList::add_points(std::span<const Point> points, Color const& color, BlendMode blend_mode)
+{
+    if (points.empty())
+        return;
+
+    const Rect bounds = bounds_of(points);
+    if (Command* last = mergeable(Kind::points, color, blend_mode))
+    {
+        last->count += static_cast<std::uint32_t>(points.size());
+        extend_bounds(*last, bounds);
+    }
+    else
+    {
+        m_commands.push_back(Command{Kind::points, color, blend_mode,
+                                     static_cast<std::uint32_t>(m_points.size()),
+                                     static_cast<std::uint32_t>(points.size()), bounds});
+        extend_bounds(m_commands.back(), bounds);
+    }
+    m_points.insert(m_points.end(), points.begin(), points.end());
+}
+
+void RenderCommandList::add_lines(std::span<const Point> points, Color const& color, BlendMode blend_mode)
+{
+    if (points.size() < 2)
+        return;
+
+    const Rect bounds = bounds_of(points);
+    Command* last = mergeable(Kind::lines, color, blend_mode);
+    if (last != nullptr && m_points.back() == points.front())
+    {
+        points = points.subspan(1);
+        last->count += static_cast<std::uint32_t>(points.size());
+        extend_bounds(*last, bounds);
+    }
+    else
+    {
+        m_commands.push_back(Command{Kind::lines, color, blend_mode,
+                                     static_cast<std::uint32_t>(m_points.size()),
+                                     static_cast<std::uint32_t>(points.size()), bounds});
+        extend_bounds(m_commands.back(), bounds);
+    }
+    m_points.insert(m_points.end(), points.begin(), points.end());
+}
+
+void RenderCommandList::add_rects(std::span<const Rect> rects, Color const& color, BlendMode blend_mode, bool filled)
+{
+    if (rects.empty())
+        return;
+
+    const Kind kind = filled ? Kind::filled_rects : Kind::rects;
+    const Rect bounds = bounds_of(rects);
+    if (Command* last = mergeable(kind, color, blend_mode))
+    {
+        last->count += static_cast<std::uint32_t>(rects.size());
+        extend_bounds(*last, bounds);
+    }
+    else
+    {
+        m_commands.push_back(Command{kind, color, blend_mode,
+                                     static_cast<std::uint32_t>(m_rects.size()),
+                                     static_cast<std::uint32_t>(rects.size()), bounds});
+        extend_bounds(m_commands.back(), bounds);
+    }
+    m_rects.insert(m_rects.end(), rects.begin(), rects.end());
+}
+
+void RenderCommandList::add_geometry(SDL_Texture* texture, std::span<const SDL_Vertex> vertices,
+                                     std::span<const int> indices, Color const& color, BlendMode blend_mode)
+{
+    if (vertices.empty())
+        return;
+
+    const Rect bounds = bounds_of(vertices);
+    Command* last = mergeable(Kind::geometry, color, blend_mode);
+    const auto base = static_cast<int>(m_vertices.size());
+    if (last != nullptr && m_geometries.back().texture == texture && m_geometries.back().index_count != 0
+        && !indices.empty())
+    {
+        // Indexed triangles of the same texture are drawn by one call, the
+        // indices moved past the vertices already there
+        Geometry& geometry = m_geometries.back();
+        const int offset = base - static_cast<int>(geometry.first_vertex);
+        for (int index : indices)
+            m_indices.push_back(index + offset);
+        geometry.vertex_count += static_cast<std::uint32_t>(vertices.size());
+        geometry.index_count += static_cast<std::uint32_t>(indices.size());
+        extend_bounds(*last, bounds);
+    }
+    else
+    {
+        m_geometries.push_back(Geometry{texture, static_cast<std::uint32_t>(base),
+                                        static_cast<std::uint32_t>(vertices.size()),
+                                        static_cast<std::uint32_t>(m_indices.size()),
+                                        static_cast<std::uint32_t>(indices.size())});
+        m_commands.push_back(Command{Kind::geometry, color, blend_mode,
+                                     static_cast<std::uint32_t>(m_geometries.size() - 1), 1, bounds});
+        extend_bounds(m_commands.back(), bounds);
+        m_indices.insert(m_indices.end(), indices.begin(), indices.end());
+    }
+    m_vertices.insert(m_vertices.end(), vertices.begin(), vertices.end());
+}
+
+void RenderCommandList::add_clear(Color const& color, BlendMode blend_mode)
+{
+    m_commands.push_back(Command{Kind::clear, color, blend_mode, 0, 0, Rect()});
+}
+
+void RenderCommandList::add_target(SDL_Texture* texture)
+{
+    // Only the last of consecutive changes matters
+    if (!m_commands.empty() && m_commands.back().kind == Kind::target)
+    {
+        m_textures[m_commands.back().first] = texture;
+        return;
+    }
+    m_textures.push_back(texture);
+    m_commands.push_back(Command{Kind::target, Color(), BlendMode(),
+                                 static_cast<std::uint32_t>(m_textures.size() - 1), 1, Rect()});
+}
+
+void RenderCommandList::add_texture_blend_mode(SDL_Texture* texture, BlendMode blend_mode)
+{
+    m_textures.push_back(texture);
+    m_commands.push_back(Command{Kind::texture_blend_mode, Color(), blend_mode,
+                                 static_cast<std::uint32_t>(m_textures.size() - 1), 1, Rect()});
+}
+
+std::size_t RenderCommandList::replay(Renderer& renderer, Point const& offset, std::optional<Rect> const& viewport) const
+{
+    SDL3PP_ZONE("RenderCommandList::replay");
+    std::size_t submitted = 0;
+    for (Command const& command : m_commands)
+    {
+        if (command.kind == Kind::clear)
+        {
+            renderer.set_draw_color(command.color);
+            renderer.set_draw_blend_mode(command.blend_mode);
+            renderer.clear();
+            continue;
+        }
+        if (command.kind == Kind::target)
+        {
+            renderer.set_target(m_textures[command.first]);
+            continue;
+        }
+        if (command.kind == Kind::texture_blend_mode)
+        {
+            renderer.set_texture_blend_mode(m_textures[command.first], command.blend_mode);
+            continue;
+        }
+
+        const Rect bounds = command.bounds + offset;
+        if (viewport && !viewport->intersects(bounds))
+            continue;
+        const bool partial = viewport && !viewport->countains(bounds);
+
+        renderer.set_draw_color(command.color);
+        renderer.set_draw_blend_mode(command.blend_mode);
+
+        switch (command.kind)
+        {
+        case Kind::points:
+            m_scratch_points.clear();
+            for (Point const& point : std::span(m_points).subspan(command.first, command.count))
+            {
+                const Point moved = point + offset;
+                if (!partial || viewport->countains(moved))
+                    m_scratch_points.push_back(moved);
+            }
+            renderer.draw_points(m_scratch_points);
+            submitted += m_scratch_points.size();
+            break;
+        case Kind::lines:
+            // a polyline is kept whole, the renderer clips it anyway
+            m_scratch_points.clear();
+            for (Point const& point : std::span(m_points).subspan(command.first, command.count))
+                m_scratch_points.push_back(point + offset);
+            renderer.draw_lines(m_scratch_points);
+            submitted += command.count - 1;
+            break;
+        case Kind::rects:
+        case Kind::filled_rects:
+            m_scratch_rects.clear();
+            for (Rect const& rect : std::span(m_rects).subspan(command.first, command.count))
+            {
+                const Rect moved = rect + offset;
+                if (!partial || viewport->intersects(moved))
+                    m_scratch_rects.push_back(moved);
+            }
+            if (command.kind == Kind::filled_rects)
+                renderer.fill_rects(m_scratch_rects);
+            else
+                renderer.draw_rects(m_scratch_rects);
+            submitted += m_scratch_rects.size();
+            break;
+        case Kind::geometry:
+        {
+            // the triangles are kept whole, the renderer clips them anyway
+            Geometry const& geometry = m_geometries[command.first];
+            m_scratch_vertices.clear();
+            for (SDL_Vertex vertex : std::span(m_vertices).subspan(geometry.first_vertex, geometry.vertex_count))
+            {
+                vertex.position.x += static_cast<float>(offset.get_x());
+                vertex.position.y += static_cast<float>(offset.get_y());
+                m_scratch_vertices.push_back(vertex);
+            }
+            const auto indices = std::span(m_indices).subspan(geometry.first_index, geometry.index_count);
+            renderer.render_geometry(geometry.texture, m_scratch_vertices, indices);
+            submitted += (indices.empty() ? geometry.vertex_count : geometry.index_count) / 3;
+            break;
+        }
+        case Kind::clear:
+        case Kind::target:
+        case Kind::texture_blend_mode:
+        default:
+            break;
+        }
+    }
+    return submitted;
+}
+
+RenderCommandList::Command* RenderCommandList::mergeable(Kind kind, Color const& color, BlendMode blend_mode) noexcept
+{
+    if (m_commands.empty())
+        return nullptr;
+    Command& last = m_commands.back();
+    if (last.kind != kind || last.blend_mode != blend_mode || !same_color(last.color, color))
+        return nullptr;
+    return &last;
+}
+
+void RenderCommandList::extend_bounds(Command& command, Rect const& bounds) noexcept
+{
+    command.bounds.union_in_place(bounds);
+    if (m_has_bounds)
+    {
+        m_bounds.union_in_place(bounds);
+    }
+    else
+    {
+        m_bounds = bounds;
+        m_has_bounds = true;
+    }
+}
+
+static_assert(std::is_trivially_copyable_v<Point> && std::is_trivially_copyable_v<Rect>);
+
+}
@@ -0,0 +1,399 @@
+#include <span>
+#include <utility>
+#include <SDL3/SDL_render.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/MemoryTracker.hpp>
+#include <SDL3pp/Profiler.hpp>
+#include <SDL3pp/RenderCommandList.hpp>
+#include <SDL3pp/Renderer.hpp>
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+SDL_FPoint to_fpoint(Point const& point) noexcept
+{
+    return SDL_FPoint{static_cast<float>(point.get_x()), static_cast<float>(point.get_y())};
+}
+
+SDL_FRect to_frect(Rect const& rect) noexcept
+{
+    return SDL_FRect{static_cast<float>(rect.get_x()), static_cast<float>(rect.get_y()),
+                     static_cast<float>(rect.get_width()), static_cast<float>(rect.get_height())};
+}
+
+}
+
+Renderer::Renderer(Window& window, const char* driver)
+ : m_renderer()
+{
+    const MemoryScope scope(MemoryTag::render);
+    m_renderer.reset(SDL3PP_CALL(SDL_CreateRenderer, window.get(), driver));
+    if (m_renderer == nullptr)
+    {
+        throw Exception("SDL_CreateRenderer");
+    }
+}
+
+Renderer::Renderer(Surface& surface)
+ : m_renderer()
+{
+    const MemoryScope scope(MemoryTag::render);
+    m_renderer.reset(SDL3PP_CALL(SDL_CreateSoftwareRenderer, surface.get()));
+    if (m_renderer == nullptr)
+    {
+        throw Exception("SDL_CreateSoftwareRenderer");
+    }
+}
+
+Renderer::Renderer(Renderer&& other) noexcept
+ : m_renderer(std::move(other.m_renderer)),
+   m_state(other.m_state),
+   m_applied(other.m_applied),
+   m_applied_valid(std::exchange(other.m_applied_valid, false)),
+   m_batching(other.m_batching),
+   m_pending(std::exchange(other.m_pending, Primitive::none)),
+   m_line_end(other.m_line_end),
+   m_points(std::move(other.m_points)),
+   m_line_runs(std::move(other.m_line_runs)),
+   m_rects(std::move(other.m_rects)),
+   m_stats(other.m_stats),
+   m_recording(std::exchange(other.m_recording, nullptr))
+{}
+
+Renderer& Renderer::operator=(Renderer&& other)
+{
+    if (&other == this)
+        return *this;
+    m_renderer = std::move(other.m_renderer);
+    m_state = other.m_state;
+    m_applied = other.m_applied;
+    m_applied_valid = std::exchange(other.m_applied_valid, false);
+    m_batching = other.m_batching;
+    m_pending = std::exchange(other.m_pending, Primitive::none);
+    m_line_end = other.m_line_end;
+    m_points = std::move(other.m_points);
+    m_line_runs = std::move(other.m_line_runs);
+    m_rects = std::move(other.m_rects);
+    m_stats = other.m_stats;
+    m_recording = std::exchange(other.m_recording, nullptr);
+
+    // A moved-from vector is only guaranteed to be empty after a construction
+    other.m_points.clear();
+    other.m_line_runs.clear();
+    other.m_rects.clear();
+    return *this;
+}
+
+void Renderer::set_batching(bool enabled)
+{
+    flush();
+    m_batching = enabled;
+}
+
+void Renderer::set_target(SDL_Texture* texture)
+{
+    if (texture == m_state.target)
+        return;
+    flush();
+    if (m_recording)
+        m_recording->add_target(texture);
+    m_state.target = texture;
+}
+
+void Renderer::set_texture_blend_mode(SDL_Texture* texture, BlendMode mode)
+{
+    if (m_recording)
+    {
+        m_recording->add_texture_blend_mode(texture, mode);
+        return;
+    }
+    if (!SDL3PP_CALL(SDL_SetTextureBlendMode, texture, mode))
+    {
+        throw Exception("SDL_SetTextureBlendMode");
+    }
+}
+
+void Renderer::begin_recording(RenderCommandList& list)
+{
+    flush();
+    // The replay draws on the target of the recording, whatever is current then
+    list.add_target(m_state.target);
+    m_recording = make_observer(&list);
+}
+
+void Renderer::draw_point(Point const& point)
+{
+    if (m_recording)
+    {
+        m_recording->add_points(std::span(&point, 1), m_state.color, m_state.blend_mode);
+        return;
+    }
+    begin(Primitive::points);
+    m_points.push_back(to_fpoint(point));
+    end_immediate();
+}
+
+void Renderer::draw_points(std::span<const Point> points)
+{
+    if (m_recording)
+    {
+        m_recording->add_points(points, m_state.color, m_state.blend_mode);
+        return;
+    }
+    begin(Primitive::points);
+    for (Point const& point : points)
+        m_points.push_back(to_fpoint(point));
+    end_immediate();
+}
+
+void Renderer::draw_line(Point const& a, Point const& b)
+{
+    if (m_recording)
+    {
+        const Point line[] = {a, b};
+        m_recording->add_lines(line, m_state.color, m_state.blend_mode);
+        return;
+    }
+    begin(Primitive::lines);
+    if (!m_line_runs.empty() && m_line_end == a)
+    {
+        ++m_line_runs.back();
+    }
+    else
+    {
+        m_points.push_back(to_fpoint(a));
+        m_line_runs.push_back(2);
+    }
+    m_points.push_back(to_fpoint(b));
+    m_line_end = b;
+    end_immediate();
+}
+
+void Renderer::draw_lines(std::span<const Point> points)
+{
+    if (m_recording)
+    {
+        m_recording->add_lines(points, m_state.color, m_state.blend_mode);
+        return;
+    }
+    if (points.size() < 2)
+        return;
+    begin(Primitive::lines);
+    if (!m_line_runs.empty() && m_line_end == points.front())
+    {
+        points = points.subspan(1);
+        m_line_runs.back() += static_cast<int>(points.size());
+    }
+    else
+    {
+        m_line_runs.push_back(static_cast<int>(points.size()));
+    }
+    for (Point const& point : points)
+        m_points.push_back(to_fpoint(point));
+    m_line_end = points.back();
+    end_immediate();
+}
+
+void Renderer::draw_rect(Rect const& rect)
+{
+    if (m_recording)
+    {
+        m_recording->add_rects(std::span(&rect, 1), m_state.color, m_state.blend_mode, false);
+        return;
+    }
+    begin(Primitive::rects);
+    m_rects.push_back(to_frect(rect));
+    end_immediate();
+}
+
+void Renderer::draw_rects(std::span<const Rect> rects)
+{
+    if (m_recording)
+    {
+        m_recording->add_rects(rects, m_state.color, m_state.blend_mode, false);
+        return;
+    }
+    begin(Primitive::rects);
+    for (Rect const& rect : rects)
+        m_rects.push_back(to_frect(rect));
+    end_immediate();
+}
+
+void Renderer::fill_rect(Rect const& rect)
+{
+    if (m_recording)
+    {
+        m_recording->add_rects(std::span(&rect, 1), m_state.color, m_state.blend_mode, true);
+        return;
+    }
+    begin(Primitive::filled_rects);
+    m_rects.push_back(to_frect(rect));
+    end_immediate();
+}
+
+void Renderer::fill_rects(std::span<const Rect> rects)
+{
+    if (m_recording)
+    {
+        m_recording->add_rects(rects, m_state.color, m_state.blend_mode, true);
+        return;
+    }
+    begin(Primitive::filled_rects);
+    for (Rect const& rect : rects)
+        m_rects.push_back(to_frect(rect));
+    end_immediate();
+}
+
+void Renderer::render_geometry(SDL_Texture* texture, std::span<const SDL_Vertex> vertices, std::span<const int> indices)
+{
+    if (m_recording)
+    {
+        m_recording->add_geometry(texture, vertices, indices, m_state.color, m_state.blend_mode);
+        return;
+    }
+    flush();
+    apply_state();
+    if (!SDL3PP_CALL(SDL_RenderGeometry, get(), texture, vertices.data(), static_cast<int>(vertices.size()),
+                     indices.data(), static_cast<int>(indices.size())))
+    {
+        throw Exception("SDL_RenderGeometry");
+    }
+    ++m_stats.draw_calls;
+    m_stats.primitives += indices.size() / 3;
+}
+
+void Renderer::clear()
+{
+    if (m_recording)
+    {
+        m_recording->add_clear(m_state.color, m_state.blend_mode);
+        return;
+    }
+    flush();
+    apply_state();
+    if (!SDL3PP_CALL(SDL_RenderClear, get()))
+    {
+        throw Exception("SDL_RenderClear");
+    }
+}
+
+void Renderer::present()
+{
+    SDL3PP_ZONE("Renderer::present");
+    flush();
+    if (!SDL3PP_CALL(SDL_RenderPresent, get()))
+    {
+        throw Exception("SDL_RenderPresent");
+    }
+}
+
+void Renderer::flush()
+{
+    if (m_pending == Primitive::none)
+        return;
+
+    SDL3PP_ZONE("Renderer::flush");
+    const Primitive pending = std::exchange(m_pending, Primitive::none);
+    apply_state();
+
+    const char* failed = nullptr;
+    switch (pending)
+    {
+    case Primitive::points:
+        if (!SDL3PP_CALL(SDL_RenderPoints, get(), m_points.data(), static_cast<int>(m_points.size())))
+            failed = "SDL_RenderPoints";
+        ++m_stats.draw_calls;
+        m_stats.primitives += m_points.size();
+        break;
+    case Primitive::lines:
+    {
+        const SDL_FPoint* run_points = m_points.data();
+        for (int run : m_line_runs)
+        {
+            if (failed == nullptr && !SDL3PP_CALL(SDL_RenderLines, get(), run_points, run))
+                failed = "SDL_RenderLines";
+            run_points += run;
+            ++m_stats.draw_calls;
+            m_stats.primitives += static_cast<std::size_t>(run - 1);
+        }
+        break;
+    }
+    case Primitive::rects:
+        if (!SDL3PP_CALL(SDL_RenderRects, get(), m_rects.data(), static_cast<int>(m_rects.size())))
+            failed = "SDL_RenderRects";
+        ++m_stats.draw_calls;
+        m_stats.primitives += m_rects.size();
+        break;
+    case Primitive::filled_rects:
+        if (!SDL3PP_CALL(SDL_RenderFillRects, get(), m_rects.data(), static_cast<int>(m_rects.size())))
+            failed = "SDL_RenderFillRects";
+        ++m_stats.draw_calls;
+        m_stats.primitives += m_rects.size();
+        break;
+    case Primitive::none:
+    default:
+        break;
+    }
+
+    m_points.clear();
+    m_line_runs.clear();
+    m_rects.clear();
+
+    if (failed != nullptr)
+    {
+        throw Exception(failed);
+    }
+}
+
+void Renderer::begin(Primitive primitive)
+{
+    if (m_pending != primitive)
+    {
+        flush();
+        m_pending = primitive;
+    }
+}
+
+void Renderer::end_immediate()
+{
+    if (!m_batching)
+        flush();
+}
+
+void Renderer::apply_state()
+{
+    if (!m_applied_valid || m_applied.target != m_state.target)
+    {
+        if (!SDL3PP_CALL(SDL_SetRenderTarget, get(), m_state.target))
+        {
+            throw Exception("SDL_SetRenderTarget");
+        }
+        ++m_stats.state_changes;
+    }
+    Color const& color = m_state.color;
+    if (!m_applied_valid || m_applied.color.r != color.r || m_applied.color.g != color.g
+        || m_applied.color.b != color.b || m_applied.color.a != color.a)
+    {
+        if (!SDL3PP_CALL(SDL_SetRenderDrawColor, get(), color.r, color.g, color.b, color.a))
+        {
+            throw Exception("SDL_SetRenderDrawColor");
+        }
+        ++m_stats.state_changes;
+    }
+    if (!m_applied_valid || m_applied.blend_mode != m_state.blend_mode)
+    {
+        if (!SDL3PP_CALL(SDL_SetRenderDrawBlendMode, get(), m_state.blend_mode))
+        {
+            throw Exception("SDL_SetRenderDrawBlendMode");
+        }
+        ++m_stats.state_changes;
+    }
+    m_applied = m_state;
+    m_applied_valid = true;
+}
+
+}
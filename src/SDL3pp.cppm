@@ -0,0 +1,155 @@
+// Named module exporting the public API of SDL3pp, built when the CMake
+// option SDL3PP_WITH_MODULE is on:
+//
+//     import sdl3pp;
+//
+// The headers are parsed once, when the module is built, instead of once
+// per translation unit. The gain has not been measured yet: importing the
+// module needs GCC 14, Clang 16 or MSVC 17.4, and
+// benchmarks/build_time/measure.cmake times it with one of them. The
+// macros can not be exported: SDL3PP_ZONE() and SDL3PP_CALL() still need
+// their header, and the flags and constants of SDL, such as
+// SDL_WINDOW_RESIZABLE, the SDL headers.
+
+module;
+
+#include <SDL3pp/SDL3pp.hpp>
+
+export module sdl3pp;
+
+export namespace SDL3pp
+{
+
+// Geometry
+using SDL3pp::Point;
+using SDL3pp::Rect;
+
+// Video and rendering
+using SDL3pp::Exception;
+using SDL3pp::WindowFlags;
+using SDL3pp::WindowID;
+using SDL3pp::Window;
+using SDL3pp::Color;
+using SDL3pp::PixelFormat;
+using SDL3pp::Surface;
+using SDL3pp::BlendMode;
+using SDL3pp::RenderStats;
+using SDL3pp::Renderer;
+using SDL3pp::TextureAccess;
+using SDL3pp::Texture;
+using SDL3pp::SpriteBatch;
+using SDL3pp::RenderCommandList;
+using SDL3pp::Camera2D;
+using SDL3pp::StreamingTextureStats;
+using SDL3pp::StreamingTexture;
+
+// Audio
+using SDL3pp::AudioDeviceID;
+using SDL3pp::AudioSpec;
+using SDL3pp::AudioStreamStats;
+using SDL3pp::AudioStream;
+using SDL3pp::VoiceHandle;
+using SDL3pp::VoiceMixerStats;
+using SDL3pp::VoiceMixer;
+using SDL3pp::AudioDecoder;
+using SDL3pp::WavDecoder;
+using SDL3pp::MusicStreamStats;
+using SDL3pp::MusicStream;
+
+// Jobs, tasks and timers
+using SDL3pp::SpscRing;
+using SDL3pp::WorkStealingDeque;
+using SDL3pp::JobSystemConfig;
+using SDL3pp::JobSystemStats;
+using SDL3pp::JobSystem;
+using SDL3pp::SmallFunction;
+using SDL3pp::MainThreadQueueStats;
+using SDL3pp::MainThreadQueue;
+using SDL3pp::CoroutineFramePoolStats;
+using SDL3pp::CoroutineFramePool;
+using SDL3pp::TaskPromiseBase;
+using SDL3pp::TaskPromise;
+using SDL3pp::Task;
+using SDL3pp::TaskSchedulerStats;
+using SDL3pp::TaskScheduler;
+using SDL3pp::next_frame;
+using SDL3pp::delay;
+using SDL3pp::load_surface;
+using SDL3pp::TimerHandle;
+using SDL3pp::TimerWheelStats;
+using SDL3pp::TimerWheel;
+
+// Memory and diagnostics
+using SDL3pp::FrameArenaStats;
+using SDL3pp::FrameArena;
+using SDL3pp::MemoryTag;
+using SDL3pp::memory_tag_count;
+using SDL3pp::get_memory_tag_name;
+using SDL3pp::MemoryTagStats;
+using SDL3pp::MemoryStats;
+using SDL3pp::MemoryTracker;
+using SDL3pp::MemoryScope;
+using SDL3pp::ProfileEvent;
+using SDL3pp::Profiler;
+using SDL3pp::ProfileZone;
+using SDL3pp::call_histogram_size;
+using SDL3pp::CallStats;
+using SDL3pp::CallSite;
+using SDL3pp::CallTracker;
+using SDL3pp::CallTimer;
+
+// Input
+using SDL3pp::key_count;
+using SDL3pp::KeyMask;
+using SDL3pp::InputState;
+using SDL3pp::EventRecorderStats;
+using SDL3pp::EventRecorder;
+using SDL3pp::PlaybackMode;
+using SDL3pp::EventPlayerStats;
+using SDL3pp::EventPlayer;
+using SDL3pp::EventCoalescerConfig;
+using SDL3pp::EventCoalescerStats;
+using SDL3pp::EventCoalescer;
+
+// Utilities
+using SDL3pp::observer_ptr;
+using SDL3pp::make_observer;
+using SDL3pp::swap;
+using SDL3pp::operator==;
+using SDL3pp::operator!=;
+using SDL3pp::operator<;
+using SDL3pp::operator>;
+using SDL3pp::operator<=;
+using SDL3pp::operator>=;
+using SDL3pp::is_trivially_relocatable;
+using SDL3pp::is_trivially_relocatable_v;
+using SDL3pp::handle_deleter;
+using SDL3pp::unique_handle;
+using SDL3pp::uninitialized_relocate;
+
+#ifdef SDL3PP_WITH_TTF
+// Text
+using SDL3pp::FontStyle;
+using SDL3pp::GlyphMetrics;
+using SDL3pp::Font;
+using SDL3pp::GlyphCacheStats;
+using SDL3pp::GlyphCache;
+using SDL3pp::TextLayoutStats;
+using SDL3pp::TextLine;
+using SDL3pp::TextPosition;
+using SDL3pp::TextLayout;
+#endif
+
+}
+
+// The operators of Point and Rect are declared in the global namespace
+export using ::operator+;
+export using ::operator-;
+export using ::operator*;
+export using ::operator/;
+export using ::operator%;
+export using ::operator==;
+export using ::operator!=;
+export using ::operator<<;
+
+export namespace sdl = SDL3pp;
@@ -0,0 +1,211 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+#include <SDL3/SDL_render.h>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/Profiler.hpp>
+#include <SDL3pp/SpriteBatch.hpp>
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+// Sort keys layout, from the most significant bits:
+// layer (16 bits) | texture slot (32 bits) | blend mode slot (8 bits) | unused (8 bits)
+constexpr int layer_shift = 48;
+constexpr int texture_shift = 16;
+constexpr int blend_mode_shift = 8;
+constexpr std::uint64_t run_mask = 0x0000'FFFF'FFFF'FF00ull;
+constexpr std::size_t max_blend_modes = 256;
+
+/**
+ * Stable LSD radix sort of 64-bit keys, 8 bits per pass, carrying a
+ * permutation along. The histograms of every pass are built in one read of
+ * the keys, and the passes where every key has the same digit are skipped,
+ * so unused key bits cost nothing.
+ */
+void radix_sort(std::vector<std::uint64_t>& keys, std::vector<std::uint32_t>& values,
+                std::vector<std::uint64_t>& keys_swap, std::vector<std::uint32_t>& values_swap)
+{
+    const std::size_t size = keys.size();
+    keys_swap.resize(size);
+    values_swap.resize(size);
+
+    std::array<std::array<std::uint32_t, 256>, 8> counts {};
+    for (std::uint64_t key : keys)
+    {
+        for (std::size_t digit = 0; digit < 8; ++digit)
+            ++counts[digit][(key >> (digit * 8)) & 0xFF];
+    }
+
+    for (std::size_t digit = 0; digit < 8; ++digit)
+    {
+        std::array<std::uint32_t, 256>& count = counts[digit];
+        const int shift = static_cast<int>(digit * 8);
+        if (count[(keys[0] >> shift) & 0xFF] == size)
+            continue;
+
+        std::uint32_t offset = 0;
+        for (std::uint32_t& bucket : count)
+            offset += std::exchange(bucket, offset);
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            const std::uint32_t position = count[(keys[i] >> shift) & 0xFF]++;
+            keys_swap[position] = keys[i];
+            values_swap[position] = values[i];
+        }
+        keys.swap(keys_swap);
+        values.swap(values_swap);
+    }
+}
+
+SDL_FColor to_fcolor(Color const& color) noexcept
+{
+    return SDL_FColor{color.r / 255.f, color.g / 255.f, color.b / 255.f, color.a / 255.f};
+}
+
+}
+
+SpriteBatch::SpriteBatch(std::size_t capacity)
+{
+    m_sprites.reserve(capacity);
+    m_keys.reserve(capacity);
+    m_keys_swap.reserve(capacity);
+    m_order.reserve(capacity);
+    m_order_swap.reserve(capacity);
+    m_vertices.reserve(capacity * 4);
+    m_indices.reserve(capacity * 6);
+}
+
+void SpriteBatch::draw(Texture const& texture, Rect const& src, Rect const& dst,
+                       std::uint16_t layer, BlendMode blend_mode, Color const& tint)
+{
+    const float texture_w = static_cast<float>(texture.get_width());
+    const float texture_h = static_cast<float>(texture.get_height());
+
+    const std::uint64_t key = std::uint64_t{layer} << layer_shift
+                            | std::uint64_t{texture_slot(texture.get())} << texture_shift
+                            | std::uint64_t{blend_mode_slot(blend_mode)} << blend_mode_shift;
+
+    m_keys.push_back(key);
+    m_order.push_back(static_cast<std::uint32_t>(m_sprites.size()));
+    m_sprites.push_back(Sprite{
+        SDL_FRect{static_cast<float>(dst.get_x()), static_cast<float>(dst.get_y()),
+                  static_cast<float>(dst.get_width()), static_cast<float>(dst.get_height())},
+        SDL_FRect{static_cast<float>(src.get_x()) / texture_w, static_cast<float>(src.get_y()) / texture_h,
+                  static_cast<float>(src.get_width()) / texture_w, static_cast<float>(src.get_height()) / texture_h},
+        to_fcolor(tint)
+    });
+}
+
+void SpriteBatch::draw(Texture const& texture, Rect const& dst,
+                       std::uint16_t layer, BlendMode blend_mode, Color const& tint)
+{
+    draw(texture, Rect(0, 0, texture.get_width(), texture.get_height()), dst, layer, blend_mode, tint);
+}
+
+void SpriteBatch::flush(Renderer& renderer)
+{
+    m_draw_calls = 0;
+    const std::size_t count = m_sprites.size();
+    if (count == 0)
+        return;
+
+    SDL3PP_ZONE("SpriteBatch::flush");
+    radix_sort(m_keys, m_order, m_keys_swap, m_order_swap);
+
+    // quads are emitted in sorted order, so every run uses a contiguous
+    // slice of the vertex buffer and the same shared index pattern
+    m_vertices.resize(count * 4);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        Sprite const& sprite = m_sprites[m_order[i]];
+        const float x1 = sprite.dst.x + sprite.dst.w;
+        const float y1 = sprite.dst.y + sprite.dst.h;
+        const float u1 = sprite.uv.x + sprite.uv.w;
+        const float v1 = sprite.uv.y + sprite.uv.h;
+        SDL_Vertex* quad = &m_vertices[i * 4];
+        quad[0] = SDL_Vertex{{sprite.dst.x, sprite.dst.y}, sprite.color, {sprite.uv.x, sprite.uv.y}};
+        quad[1] = SDL_Vertex{{x1, sprite.dst.y}, sprite.color, {u1, sprite.uv.y}};
+        quad[2] = SDL_Vertex{{x1, y1}, sprite.color, {u1, v1}};
+        quad[3] = SDL_Vertex{{sprite.dst.x, y1}, sprite.color, {sprite.uv.x, v1}};
+    }
+    for (int quad = static_cast<int>(m_indices.size() / 6); m_indices.size() < count * 6; ++quad)
+    {
+        const int base = quad * 4;
+        m_indices.insert(m_indices.end(), {base, base + 1, base + 2, base + 2, base + 3, base});
+    }
+
+    const std::span<const SDL_Vertex> vertices(m_vertices);
+    const std::span<const int> indices(m_indices);
+    std::size_t start = 0;
+    for (std::size_t i = 1; i <= count; ++i)
+    {
+        if (i != count && ((m_keys[i] ^ m_keys[start]) & run_mask) == 0)
+            continue;
+
+        SDL_Texture* texture = m_textures[(m_keys[start] >> texture_shift) & 0xFFFF'FFFF];
+        const BlendMode blend_mode = m_blend_modes[(m_keys[start] >> blend_mode_shift) & 0xFF];
+        try
+        {
+            // Recorded along with the geometry while the renderer records
+            renderer.set_texture_blend_mode(texture, blend_mode);
+        }
+        catch (...)
+        {
+            clear();
+            throw;
+        }
+        const std::size_t run = i - start;
+        renderer.render_geometry(texture, vertices.subspan(start * 4, run * 4), indices.first(run * 6));
+        ++m_draw_calls;
+        start = i;
+    }
+
+    clear();
+}
+
+void SpriteBatch::clear() noexcept
+{
+    m_sprites.clear();
+    m_keys.clear();
+    m_order.clear();
+    m_textures.clear();
+    m_texture_slots.clear();
+    m_blend_modes.clear();
+}
+
+std::uint32_t SpriteBatch::texture_slot(SDL_Texture* texture)
+{
+    if (!m_textures.empty() && m_textures.back() == texture)
+        return static_cast<std::uint32_t>(m_textures.size() - 1);
+
+    auto [it, inserted] = m_texture_slots.try_emplace(texture, static_cast<std::uint32_t>(m_textures.size()));
+    if (inserted)
+        m_textures.push_back(texture);
+    return it->second;
+}
+
+std::uint32_t SpriteBatch::blend_mode_slot(BlendMode blend_mode)
+{
+    for (std::size_t slot = 0; slot < m_blend_modes.size(); ++slot)
+    {
+        if (m_blend_modes[slot] == blend_mode)
+            return static_cast<std::uint32_t>(slot);
+    }
+    if (m_blend_modes.size() == max_blend_modes)
+    {
+        SDL_SetError("SpriteBatch supports at most %zu distinct blend modes per flush", max_blend_modes);
+        throw Exception("SpriteBatch::draw");
+    }
+    m_blend_modes.push_back(blend_mode);
+    return static_cast<std::uint32_t>(m_blend_modes.size() - 1);
+}
+
+}
@@ -0,0 +1,274 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_pixels.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/Profiler.hpp>
+#include <SDL3pp/StreamingTexture.hpp>
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+// Past this number of separate regions, a region list is collapsed into
+// its bounding box: one larger copy is cheaper than many tiny ones.
+constexpr std::size_t max_regions = 16;
+
+}
+
+StreamingTexture::StreamingTexture(Renderer& renderer, int w, int h, PixelFormat format, std::size_t count)
+ : m_width(w),
+   m_height(h),
+   m_pitch(w * SDL_BYTESPERPIXEL(format)),
+   m_bytes_per_pixel(SDL_BYTESPERPIXEL(format)),
+   m_textures(),
+   m_owed(std::max<std::size_t>(count, 2), std::vector<Rect>{Rect(0, 0, w, h)}),
+   m_slots(std::max<std::size_t>(count, 2))
+{
+    m_textures.reserve(m_slots.size());
+    for (std::size_t i = 0; i < m_slots.size(); ++i)
+    {
+        m_textures.emplace_back(renderer, format, SDL_TEXTUREACCESS_STREAMING, w, h);
+        m_slots[i].pixels.resize(static_cast<std::size_t>(m_pitch) * static_cast<std::size_t>(h));
+    }
+}
+
+StreamingTexture::Frame StreamingTexture::acquire()
+{
+    const auto start = std::chrono::steady_clock::now();
+    std::unique_lock lock(m_mutex);
+    m_slot_freed.wait(lock, [this] { return !m_writing && find_free_slot(); });
+    m_stats.stall_time += std::chrono::steady_clock::now() - start;
+    return start_frame(lock, *find_free_slot());
+}
+
+std::optional<StreamingTexture::Frame> StreamingTexture::try_acquire()
+{
+    std::unique_lock lock(m_mutex);
+    if (m_writing)
+        return std::nullopt;
+    const std::optional<std::size_t> slot = find_free_slot();
+    if (!slot)
+        return std::nullopt;
+    return start_frame(lock, *slot);
+}
+
+bool StreamingTexture::update()
+{
+    SDL3PP_ZONE("StreamingTexture::update");
+    std::size_t slot = 0;
+    std::size_t target = 0;
+    {
+        std::lock_guard lock(m_mutex);
+        std::optional<std::size_t> newest;
+        for (std::size_t i = 0; i < m_slots.size(); ++i)
+        {
+            if (m_slots[i].state != SlotState::ready)
+                continue;
+            if (newest && m_slots[*newest].sequence > m_slots[i].sequence)
+            {
+                m_slots[i].state = SlotState::free;
+                ++m_stats.frames_dropped;
+            }
+            else
+            {
+                if (newest)
+                {
+                    m_slots[*newest].state = SlotState::free;
+                    ++m_stats.frames_dropped;
+                }
+                newest = i;
+            }
+        }
+        if (!newest)
+            return false;
+
+        slot = *newest;
+        m_slots[slot].state = SlotState::uploading;
+        target = (m_current + 1) % m_textures.size();
+        m_upload_regions.clear();
+        m_upload_regions.swap(m_owed[target]);
+    }
+    m_slot_freed.notify_all();
+
+    // the slot is not touched by the producers while it is uploading
+    const auto start = std::chrono::steady_clock::now();
+    std::size_t bytes = 0;
+    const char* failed = nullptr;
+    for (Rect const& rect : m_upload_regions)
+    {
+        if (!SDL3PP_CALL(SDL_UpdateTexture, m_textures[target].get(), reinterpret_cast<const SDL_Rect*>(&rect),
+                         pixels_at(m_slots[slot], rect), m_pitch))
+        {
+            failed = "SDL_UpdateTexture";
+            break;
+        }
+        bytes += static_cast<std::size_t>(rect.get_width()) * static_cast<std::size_t>(rect.get_height())
+               * static_cast<std::size_t>(m_bytes_per_pixel);
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_slots[slot].state = SlotState::free;
+        m_stats.upload_bytes += bytes;
+        m_stats.upload_time += elapsed;
+        if (failed != nullptr)
+        {
+            // upload everything again next time
+            m_owed[target].assign(1, Rect(0, 0, m_width, m_height));
+        }
+        else
+        {
+            m_current = target;
+            ++m_stats.frames_uploaded;
+        }
+    }
+    m_slot_freed.notify_all();
+
+    if (failed != nullptr)
+    {
+        throw Exception(failed);
+    }
+    return true;
+}
+
+StreamingTextureStats StreamingTexture::get_stats() const
+{
+    std::lock_guard lock(m_mutex);
+    return m_stats;
+}
+
+void StreamingTexture::reset_stats()
+{
+    std::lock_guard lock(m_mutex);
+    m_stats = StreamingTextureStats();
+}
+
+void StreamingTexture::Frame::mark_dirty(Rect const& rect)
+{
+    const std::optional<Rect> clipped = rect.get_intersection(Rect(0, 0, m_owner->m_width, m_owner->m_height));
+    if (clipped)
+        m_owner->add_region(m_owner->m_slots[m_slot].dirty, *clipped);
+}
+
+void StreamingTexture::Frame::mark_all_dirty()
+{
+    m_owner->m_slots[m_slot].dirty.assign(1, Rect(0, 0, m_owner->m_width, m_owner->m_height));
+}
+
+void StreamingTexture::Frame::submit()
+{
+    if (m_owner != nullptr)
+        std::exchange(m_owner, nullptr)->submit(m_slot);
+}
+
+std::optional<std::size_t> StreamingTexture::find_free_slot() const noexcept
+{
+    for (std::size_t i = 0; i < m_slots.size(); ++i)
+    {
+        if (m_slots[i].state == SlotState::free)
+            return i;
+    }
+    return std::nullopt;
+}
+
+StreamingTexture::Frame StreamingTexture::start_frame(std::unique_lock<std::mutex>& lock, std::size_t slot)
+{
+    Slot& target = m_slots[slot];
+    target.state = SlotState::writing;
+    target.dirty.clear();
+    m_writing = true;
+    const std::optional<std::size_t> latest = m_latest;
+    lock.unlock();
+
+    // Only the writer touches the stale list of the slot being written and
+    // the latest slot content is complete and read-only, so the catch-up
+    // copy does not need the lock.
+    if (latest && *latest != slot)
+    {
+        for (Rect const& rect : target.stale)
+            copy_region(m_slots[*latest], target, rect);
+    }
+    target.stale.clear();
+    return Frame(*this, slot);
+}
+
+void StreamingTexture::submit(std::size_t slot)
+{
+    {
+        std::lock_guard lock(m_mutex);
+        Slot& submitted = m_slots[slot];
+        for (Rect const& rect : submitted.dirty)
+        {
+            for (std::size_t i = 0; i < m_slots.size(); ++i)
+            {
+                if (i != slot)
+                    add_region(m_slots[i].stale, rect);
+            }
+            for (std::vector<Rect>& owed : m_owed)
+                add_region(owed, rect);
+        }
+        submitted.state = SlotState::ready;
+        submitted.sequence = ++m_sequence;
+        m_latest = slot;
+        m_writing = false;
+        ++m_stats.frames_submitted;
+    }
+    m_slot_freed.notify_all();
+}
+
+void StreamingTexture::cancel(std::size_t slot)
+{
+    {
+        std::lock_guard lock(m_mutex);
+        // the content may have been partially overwritten, restore it
+        // entirely on next use
+        m_slots[slot].stale.assign(1, Rect(0, 0, m_width, m_height));
+        m_slots[slot].state = SlotState::free;
+        m_writing = false;
+    }
+    m_slot_freed.notify_all();
+}
+
+void StreamingTexture::add_region(std::vector<Rect>& regions, Rect const& rect) const
+{
+    if (regions.size() < max_regions)
+    {
+        regions.push_back(rect);
+        return;
+    }
+    Rect bounds = rect;
+    for (Rect const& region : regions)
+        bounds.union_in_place(region);
+    regions.assign(1, bounds);
+}
+
+void StreamingTexture::copy_region(Slot const& src, Slot& dst, Rect const& rect) const noexcept
+{
+    const std::size_t row = static_cast<std::size_t>(rect.get_width()) * static_cast<std::size_t>(m_bytes_per_pixel);
+    const std::ptrdiff_t offset = pixels_at(dst, rect) - dst.pixels.data();
+    for (int y = 0; y < rect.get_height(); ++y)
+    {
+        const std::ptrdiff_t line = offset + static_cast<std::ptrdiff_t>(y) * m_pitch;
+        std::memcpy(dst.pixels.data() + line, src.pixels.data() + line, row);
+    }
+}
+
+unsigned char* StreamingTexture::pixels_at(Slot& slot, Rect const& rect) const noexcept
+{
+    return slot.pixels.data()
+         + static_cast<std::ptrdiff_t>(rect.get_y()) * m_pitch
+         + static_cast<std::ptrdiff_t>(rect.get_x()) * m_bytes_per_pixel;
+}
+
+}
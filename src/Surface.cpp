@@ -0,0 +1,21 @@
+#include <SDL3/SDL_surface.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/MemoryTracker.hpp>
+#include <SDL3pp/Surface.hpp>
+
+namespace SDL3pp
+{
+
+Surface::Surface(int w, int h, PixelFormat format)
+ : m_surface()
+{
+    const MemoryScope scope(MemoryTag::surface);
+    m_surface.reset(SDL3PP_CALL(SDL_CreateSurface, w, h, format));
+    if (m_surface == nullptr)
+    {
+        throw Exception("SDL_CreateSurface");
+    }
+}
+
+}
@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <string>
+#include <utility>
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_surface.h>
+#include <SDL3/SDL_timer.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/Config.hpp>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/Profiler.hpp>
+#include <SDL3pp/Task.hpp>
+
+#ifdef SDL3PP_WITH_IMAGE
+#include <SDL3_image/SDL_image.h>
+#endif
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+#ifdef SDL3PP_WITH_IMAGE
+constexpr const char* load_function = "IMG_Load";
+#else
+constexpr const char* load_function = "SDL_LoadBMP";
+#endif
+
+SDL_Surface* load_file(const char* path)
+{
+#ifdef SDL3PP_WITH_IMAGE
+    return SDL3PP_CALL(IMG_Load, path);
+#else
+    return SDL3PP_CALL(SDL_LoadBMP, path);
+#endif
+}
+
+}
+
+TaskScheduler::TaskScheduler(JobSystem& jobs)
+ : m_jobs(jobs)
+{}
+
+TaskScheduler::~TaskScheduler()
+{
+    // The jobs write into awaiters living in the coroutine frames
+    m_jobs.wait(m_loads);
+
+    // Destroying a spawned task destroys the tasks it awaits, which own
+    // their frames
+    while (m_spawned != nullptr)
+    {
+        TaskPromiseBase* const promise = m_spawned;
+        m_spawned = promise->m_next_spawned;
+        promise->m_spawned_handle.destroy();
+    }
+}
+
+void TaskScheduler::spawn(Task<void> task)
+{
+    const std::coroutine_handle<TaskPromise<void>> handle = std::exchange(task.m_handle, nullptr);
+    TaskPromise<void>& promise = handle.promise();
+    promise.m_scheduler = this;
+    promise.m_spawned_handle = handle;
+    promise.m_next_spawned = m_spawned;
+    if (m_spawned != nullptr)
+        m_spawned->m_previous_spawned = &promise;
+    m_spawned = &promise;
+    ++m_task_count;
+    ++m_stats.spawned_tasks;
+
+    // A failure seen by finish() now belongs to this task, unless an
+    // enclosing update() already has one to report
+    const bool had_failure = static_cast<bool>(m_failure);
+    handle.resume();
+    if (!had_failure && m_failure)
+        std::rethrow_exception(std::exchange(m_failure, nullptr));
+}
+
+std::size_t TaskScheduler::update()
+{
+    return update(SDL3PP_CALL(SDL_GetTicks));
+}
+
+std::size_t TaskScheduler::update(Uint64 ticks)
+{
+    SDL3PP_ZONE("TaskScheduler::update");
+    m_ticks = std::max(m_ticks, ticks);
+    ++m_frame;
+
+    // The finished loads push their coroutines to m_ready
+    m_completions.drain();
+
+    m_ready.insert(m_ready.end(), m_next_frame.begin(), m_next_frame.end());
+    m_next_frame.clear();
+    while (!m_timers.empty() && m_timers.front().deadline <= m_ticks)
+    {
+        std::pop_heap(m_timers.begin(), m_timers.end(), &TaskScheduler::is_later);
+        m_ready.push_back(m_timers.back().handle);
+        m_timers.pop_back();
+    }
+
+    // The coroutines suspending again while the batch runs land in the
+    // emptied lists, for the next frame
+    m_batch.swap(m_ready);
+    for (const std::coroutine_handle<> handle : m_batch)
+        handle.resume();
+    const std::size_t resumed = m_batch.size();
+    m_batch.clear();
+    m_stats.resumptions += resumed;
+
+    if (m_failure)
+        std::rethrow_exception(std::exchange(m_failure, nullptr));
+    return resumed;
+}
+
+TaskSchedulerStats TaskScheduler::get_stats() const noexcept
+{
+    return m_stats;
+}
+
+void TaskScheduler::reset_stats() noexcept
+{
+    m_stats = {};
+}
+
+void TaskScheduler::finish(TaskPromiseBase& promise) noexcept
+{
+    if (promise.m_previous_spawned != nullptr)
+        promise.m_previous_spawned->m_next_spawned = promise.m_next_spawned;
+    else
+        m_spawned = promise.m_next_spawned;
+    if (promise.m_next_spawned != nullptr)
+        promise.m_next_spawned->m_previous_spawned = promise.m_previous_spawned;
+    --m_task_count;
+    ++m_stats.finished_tasks;
+
+    // Only the first failure of a batch is reported
+    if (promise.m_exception && !m_failure)
+        m_failure = promise.m_exception;
+    promise.m_spawned_handle.destroy();
+}
+
+void TaskScheduler::load(LoadSurfaceAwaiter& awaiter, std::coroutine_handle<> handle)
+{
+    m_jobs.submit(
+        [this, &awaiter, handle] {
+            SDL3PP_ZONE("TaskScheduler::load");
+            awaiter.m_surface.reset(load_file(awaiter.m_path.c_str()));
+            if (awaiter.m_surface == nullptr)
+                awaiter.m_error = SDL_GetError();
+            m_completions.post([this, handle] {
+                ++m_stats.loaded_surfaces;
+                m_ready.push_back(handle);
+            });
+        },
+        &m_loads);
+}
+
+Surface TaskScheduler::LoadSurfaceAwaiter::await_resume()
+{
+    if (m_surface == nullptr)
+    {
+        // The error was raised on the thread of the job
+        SDL_SetError("%s", m_error.c_str());
+        throw Exception(load_function);
+    }
+    return Surface(m_surface.release());
+}
+
+}
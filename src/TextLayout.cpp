@@ -0,0 +1,375 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3pp/Profiler.hpp>
+#include <SDL3pp/TextLayout.hpp>
+
+namespace SDL3pp
+{
+
+TextLayout::TextLayout(Font const& font, int wrap_width)
+ : m_font(&font),
+   m_wrap_width(wrap_width)
+{
+    invalidate();
+    set_text({});
+}
+
+void TextLayout::set_text(std::string_view text)
+{
+    m_paragraphs.clear();
+    std::size_t begin = 0;
+    for (;;)
+    {
+        const std::size_t end = text.find('\n', begin);
+        m_paragraphs.push_back(make_paragraph(text.substr(begin, end - begin)));
+        if (end == std::string_view::npos)
+            break;
+        begin = end + 1;
+    }
+    rebuild_heights();
+}
+
+std::string TextLayout::get_text() const
+{
+    std::string text;
+    for (Paragraph const& paragraph : m_paragraphs)
+    {
+        if (&paragraph != &m_paragraphs.front())
+            text += '\n';
+        text += paragraph.text;
+    }
+    return text;
+}
+
+void TextLayout::set_paragraph(std::size_t paragraph, std::string_view text)
+{
+    m_paragraphs[paragraph].text = text;
+    unshape(paragraph);
+}
+
+void TextLayout::insert_paragraph(std::size_t paragraph, std::string_view text)
+{
+    m_paragraphs.insert(m_paragraphs.begin() + static_cast<std::ptrdiff_t>(paragraph), make_paragraph(text));
+    rebuild_heights();
+}
+
+void TextLayout::erase_paragraph(std::size_t paragraph)
+{
+    m_paragraphs.erase(m_paragraphs.begin() + static_cast<std::ptrdiff_t>(paragraph));
+    rebuild_heights();
+}
+
+void TextLayout::insert_text(std::size_t paragraph, std::size_t offset, std::string_view text)
+{
+    std::string& target = m_paragraphs[paragraph].text;
+    std::size_t end = text.find('\n');
+    if (end == std::string_view::npos)
+    {
+        target.insert(offset, text);
+        unshape(paragraph);
+        return;
+    }
+
+    // Split the paragraph: the first line of the text ends it, the last one
+    // starts the paragraph holding the rest of it
+    std::string rest = target.substr(offset);
+    target.erase(offset);
+    target += text.substr(0, end);
+    unshape(paragraph);
+
+    std::vector<Paragraph> inserted;
+    for (;;)
+    {
+        const std::size_t begin = end + 1;
+        end = text.find('\n', begin);
+        if (end == std::string_view::npos)
+        {
+            inserted.push_back(make_paragraph(std::string(text.substr(begin)) + rest));
+            break;
+        }
+        inserted.push_back(make_paragraph(text.substr(begin, end - begin)));
+    }
+    m_paragraphs.insert(m_paragraphs.begin() + static_cast<std::ptrdiff_t>(paragraph + 1),
+                        std::make_move_iterator(inserted.begin()), std::make_move_iterator(inserted.end()));
+    rebuild_heights();
+}
+
+void TextLayout::erase_text(std::size_t paragraph, std::size_t offset, std::size_t count)
+{
+    m_paragraphs[paragraph].text.erase(offset, count);
+    unshape(paragraph);
+}
+
+void TextLayout::set_wrap_width(int wrap_width)
+{
+    if (wrap_width == m_wrap_width)
+        return;
+    m_wrap_width = wrap_width;
+    for (Paragraph& paragraph : m_paragraphs)
+    {
+        paragraph.shaped = false;
+        paragraph.height = estimate_height(paragraph.text);
+    }
+    rebuild_heights();
+}
+
+void TextLayout::invalidate()
+{
+    m_advances.clear();
+    m_line_skip = m_font->get_line_skip();
+    m_average_advance = m_font->get_glyph_metrics('x').advance;
+    for (Paragraph& paragraph : m_paragraphs)
+    {
+        paragraph.shaped = false;
+        paragraph.height = estimate_height(paragraph.text);
+    }
+    rebuild_heights();
+}
+
+template <typename Lines>
+void TextLayout::collect_lines(Rect const& area, Lines& lines)
+{
+    lines.clear();
+    if (m_paragraphs.empty())
+        return;
+
+    std::size_t index = find_paragraph(area.get_y());
+    int top = get_top(index);
+    while (index < m_paragraphs.size() && top <= area.get_y2())
+    {
+        shape(index);
+        Paragraph const& paragraph = m_paragraphs[index];
+        for (std::size_t line = 0; line < paragraph.lines.size(); ++line)
+        {
+            const int y = top + static_cast<int>(line) * m_line_skip;
+            if (y > area.get_y2() || y + m_line_skip <= area.get_y())
+                continue;
+            lines.push_back(TextLine{index, line, Rect(0, y, paragraph.lines[line].width, m_line_skip),
+                                     line_text(paragraph, paragraph.lines[line])});
+        }
+        top += paragraph.height;
+        ++index;
+    }
+}
+
+void TextLayout::get_lines(Rect const& area, std::vector<TextLine>& lines)
+{
+    collect_lines(area, lines);
+}
+
+std::pmr::vector<TextLine> TextLayout::get_lines(Rect const& area, std::pmr::polymorphic_allocator<TextLine> allocator)
+{
+    std::pmr::vector<TextLine> lines(allocator);
+    collect_lines(area, lines);
+    return lines;
+}
+
+std::optional<Rect> TextLayout::get_line_bounds(std::size_t paragraph, std::size_t line)
+{
+    shape(paragraph);
+    if (line >= m_paragraphs[paragraph].lines.size())
+        return std::nullopt;
+    return Rect(0, get_top(paragraph) + static_cast<int>(line) * m_line_skip,
+                m_paragraphs[paragraph].lines[line].width, m_line_skip);
+}
+
+std::optional<TextPosition> TextLayout::hit_test(Point const& point)
+{
+    if (m_paragraphs.empty())
+        return std::nullopt;
+
+    // Shaping a paragraph fixes its estimated height, so the point may end
+    // up in one of the following paragraphs
+    std::size_t index = find_paragraph(point.get_y());
+    int top = get_top(index);
+    shape(index);
+    while (point.get_y() >= top + m_paragraphs[index].height && index + 1 < m_paragraphs.size())
+    {
+        top += m_paragraphs[index].height;
+        shape(++index);
+    }
+
+    Paragraph const& paragraph = m_paragraphs[index];
+    const int row = std::clamp((point.get_y() - top) / std::max(m_line_skip, 1), 0,
+                               static_cast<int>(paragraph.lines.size()) - 1);
+    Line const& line = paragraph.lines[static_cast<std::size_t>(row)];
+
+    // Closest glyph boundary of the line, the end of the line included
+    const auto first = paragraph.glyphs.begin() + line.first_glyph;
+    const auto last = paragraph.glyphs.begin() + line.end_glyph + 1;
+    const int x = point.get_x() + line.x;
+    auto found = std::lower_bound(first, last, x, [](Glyph const& glyph, int value) { return glyph.x < value; });
+    if (found == last || (found != first && x - (found - 1)->x < found->x - x))
+        --found;
+    return TextPosition{index, found->offset};
+}
+
+void TextLayout::draw(GlyphCache& glyphs, SpriteBatch& batch, Point const& origin, Rect const& area,
+                      Color const& color, std::uint16_t layer)
+{
+    get_lines(area, m_visible);
+    for (TextLine const& line : m_visible)
+        glyphs.draw_text(batch, *m_font, line.text, origin + line.bounds.get_top_left(), color, layer);
+}
+
+TextLayout::Paragraph TextLayout::make_paragraph(std::string_view text) const
+{
+    Paragraph paragraph;
+    paragraph.text = text;
+    paragraph.height = estimate_height(text);
+    return paragraph;
+}
+
+void TextLayout::shape(std::size_t index)
+{
+    Paragraph& paragraph = m_paragraphs[index];
+    if (paragraph.shaped)
+        return;
+
+    SDL3PP_ZONE("TextLayout::shape");
+    // Glyph positions, with a final entry for the end of the paragraph
+    paragraph.glyphs.clear();
+    const char* const text = paragraph.text.data();
+    const char* next = text;
+    std::size_t left = paragraph.text.size();
+    std::uint32_t previous = 0;
+    int x = 0;
+    while (left > 0)
+    {
+        const auto offset = static_cast<std::uint32_t>(next - text);
+        const std::uint32_t glyph = SDL_StepUTF8(&next, &left);
+        if (previous != 0)
+            x += m_font->get_kerning(previous, glyph);
+        paragraph.glyphs.push_back(Glyph{offset, x});
+        x += advance(glyph);
+        previous = glyph;
+    }
+    const auto count = static_cast<std::uint32_t>(paragraph.glyphs.size());
+    paragraph.glyphs.push_back(Glyph{static_cast<std::uint32_t>(paragraph.text.size()), x});
+
+    // Greedy line breaking, after the last space or before the first glyph
+    // which does not fit, the spaces ending a line may overflow it
+    paragraph.lines.clear();
+    std::uint32_t first = 0;
+    std::uint32_t last_break = 0;
+    for (std::uint32_t i = 0; i < count; ++i)
+    {
+        if (paragraph.text[paragraph.glyphs[i].offset] == ' ')
+            last_break = i + 1;
+        const int line_x = paragraph.glyphs[first].x;
+        if (m_wrap_width > 0 && i > first && paragraph.glyphs[i + 1].x - line_x > m_wrap_width)
+        {
+            const std::uint32_t end = last_break > first ? last_break : i;
+            paragraph.lines.push_back(Line{first, end, line_x, paragraph.glyphs[end].x - line_x});
+            first = end;
+        }
+    }
+    paragraph.lines.push_back(Line{first, count, paragraph.glyphs[first].x,
+                                   paragraph.glyphs[count].x - paragraph.glyphs[first].x});
+    paragraph.shaped = true;
+
+    const int height = static_cast<int>(paragraph.lines.size()) * m_line_skip;
+    add_height(index, height - paragraph.height);
+    paragraph.height = height;
+
+    ++m_stats.shaped_paragraphs;
+    m_stats.shaped_glyphs += count;
+}
+
+void TextLayout::unshape(std::size_t index)
+{
+    Paragraph& paragraph = m_paragraphs[index];
+    paragraph.shaped = false;
+    const int height = estimate_height(paragraph.text);
+    add_height(index, height - paragraph.height);
+    paragraph.height = height;
+}
+
+int TextLayout::estimate_height(std::string_view text) const noexcept
+{
+    if (m_wrap_width <= 0)
+        return m_line_skip;
+    const auto width = static_cast<long long>(text.size()) * m_average_advance;
+    const auto lines = std::max<long long>((width + m_wrap_width - 1) / m_wrap_width, 1);
+    return static_cast<int>(lines) * m_line_skip;
+}
+
+int TextLayout::advance(std::uint32_t glyph)
+{
+    const auto it = m_advances.find(glyph);
+    if (it != m_advances.end())
+        return it->second;
+    const int value = m_font->get_glyph_metrics(glyph).advance;
+    m_advances.emplace(glyph, value);
+    return value;
+}
+
+std::string_view TextLayout::line_text(Paragraph const& paragraph, Line const& line) const noexcept
+{
+    const std::uint32_t begin = paragraph.glyphs[line.first_glyph].offset;
+    const std::uint32_t end = paragraph.glyphs[line.end_glyph].offset;
+    return std::string_view(paragraph.text).substr(begin, end - begin);
+}
+
+// Paragraph heights are stored in a Fenwick tree: m_heights[i] holds the sum
+// of the heights of the paragraphs (i - lowbit(i), i], indices from 1.
+
+void TextLayout::rebuild_heights() noexcept
+{
+    const std::size_t size = m_paragraphs.size();
+    m_heights.assign(size + 1, 0);
+    m_total_height = 0;
+    for (std::size_t i = 1; i <= size; ++i)
+    {
+        m_heights[i] += m_paragraphs[i - 1].height;
+        m_total_height += m_paragraphs[i - 1].height;
+        const std::size_t parent = i + (i & (~i + 1));
+        if (parent <= size)
+            m_heights[parent] += m_heights[i];
+    }
+}
+
+void TextLayout::add_height(std::size_t paragraph, int delta) noexcept
+{
+    for (std::size_t i = paragraph + 1; i < m_heights.size(); i += i & (~i + 1))
+        m_heights[i] += delta;
+    m_total_height += delta;
+}
+
+int TextLayout::get_top(std::size_t paragraph) const noexcept
+{
+    int top = 0;
+    for (std::size_t i = paragraph; i > 0; i -= i & (~i + 1))
+        top += m_heights[i];
+    return top;
+}
+
+std::size_t TextLayout::find_paragraph(int y) const noexcept
+{
+    // Number of paragraphs ending at or above y, found by descending the tree
+    const std::size_t size = m_paragraphs.size();
+    std::size_t step = 1;
+    while (step * 2 <= size)
+        step *= 2;
+    std::size_t index = 0;
+    int remaining = y;
+    for (; step > 0; step /= 2)
+    {
+        if (index + step <= size && m_heights[index + step] <= remaining)
+        {
+            index += step;
+            remaining -= m_heights[index];
+        }
+    }
+    return std::min(index, size - 1);
+}
+
+}
@@ -0,0 +1,32 @@
+#include <SDL3/SDL_render.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/MemoryTracker.hpp>
+#include <SDL3pp/Texture.hpp>
+
+namespace SDL3pp
+{
+
+Texture::Texture(Renderer& renderer, PixelFormat format, TextureAccess access, int w, int h)
+ : m_texture()
+{
+    const MemoryScope scope(MemoryTag::render);
+    m_texture.reset(SDL3PP_CALL(SDL_CreateTexture, renderer.get(), format, access, w, h));
+    if (m_texture == nullptr)
+    {
+        throw Exception("SDL_CreateTexture");
+    }
+}
+
+Texture::Texture(Renderer& renderer, Surface const& surface)
+ : m_texture()
+{
+    const MemoryScope scope(MemoryTag::render);
+    m_texture.reset(SDL3PP_CALL(SDL_CreateTextureFromSurface, renderer.get(), surface.get()));
+    if (m_texture == nullptr)
+    {
+        throw Exception("SDL_CreateTextureFromSurface");
+    }
+}
+
+}
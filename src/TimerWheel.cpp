@@ -0,0 +1,269 @@
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <SDL3/SDL_init.h>
+#include <SDL3/SDL_timer.h>
+#include <SDL3pp/CallTracker.hpp>
+#include <SDL3pp/Exception.hpp>
+#include <SDL3pp/Profiler.hpp>
+#include <SDL3pp/TimerWheel.hpp>
+
+namespace SDL3pp
+{
+
+TimerWheel::TimerWheel(std::size_t capacity)
+ : TimerWheel(capacity, SDL3PP_CALL(SDL_GetTicks))
+{
+}
+
+TimerWheel::TimerWheel(std::size_t capacity, Uint64 ticks)
+ : m_ticks(ticks)
+{
+    m_timers.reserve(capacity);
+    m_slots.fill(no_timer);
+}
+
+TimerWheel::~TimerWheel()
+{
+    if (m_sdl_timer != 0)
+        SDL3PP_CALL(SDL_RemoveTimer, m_sdl_timer);
+}
+
+bool TimerWheel::cancel(TimerHandle timer) noexcept
+{
+    if (!is_pending(timer))
+        return false;
+    unlink(timer.index);
+    release(timer.index);
+    ++m_stats.cancelled_timers;
+    return true;
+}
+
+std::size_t TimerWheel::update()
+{
+    return advance(SDL3PP_CALL(SDL_GetTicks));
+}
+
+std::size_t TimerWheel::advance(Uint64 ticks)
+{
+    SDL3PP_ZONE("TimerWheel::advance");
+    // Visit only the ticks with timers to expire, or ending a turn of the
+    // lowest wheel
+    while (m_ticks < ticks)
+    {
+        m_ticks = find_next_tick(ticks);
+        const auto index = static_cast<std::uint32_t>(m_ticks & (slot_count - 1));
+        if (index == 0)
+            cascade(1);
+        collect(index);
+    }
+
+    // Run the batch once the wheel is consistent, the callbacks being free
+    // to add and cancel timers
+    std::size_t expired = 0;
+    for (const TimerHandle handle : m_expired)
+    {
+        // Cancelled by a previous callback of the batch
+        if (m_timers[handle.index].generation != handle.generation)
+            continue;
+        // Moved out, as the callback may grow m_timers
+        Callback callback = std::move(m_timers[handle.index].callback);
+        callback();
+        ++expired;
+
+        Timer& timer = m_timers[handle.index];
+        if (timer.generation != handle.generation)
+            continue;
+        if (timer.interval == 0)
+        {
+            release(handle.index);
+            continue;
+        }
+        // A period shorter than the frame fires once per advance
+        timer.deadline = std::max(timer.deadline + timer.interval, m_ticks + 1);
+        timer.callback = std::move(callback);
+        schedule(handle.index);
+    }
+    m_expired.clear();
+    m_stats.expired_timers += expired;
+    return expired;
+}
+
+void TimerWheel::set_sdl_timer(Uint32 interval)
+{
+    if (m_sdl_timer != 0)
+    {
+        SDL3PP_CALL(SDL_RemoveTimer, m_sdl_timer);
+        m_sdl_timer = 0;
+    }
+    if (interval == 0)
+        return;
+    m_sdl_timer = SDL3PP_CALL(SDL_AddTimer, interval, &TimerWheel::on_sdl_timer, this);
+    if (m_sdl_timer == 0)
+    {
+        throw Exception("SDL_AddTimer");
+    }
+}
+
+TimerWheelStats TimerWheel::get_stats() const noexcept
+{
+    return m_stats;
+}
+
+void TimerWheel::reset_stats() noexcept
+{
+    m_stats = {};
+}
+
+TimerHandle TimerWheel::insert(Callback&& callback, Uint64 delay, Uint64 interval)
+{
+    std::uint32_t index = m_free;
+    if (index != no_timer)
+    {
+        m_free = m_timers[index].next;
+    }
+    else
+    {
+        index = static_cast<std::uint32_t>(m_timers.size());
+        m_timers.emplace_back();
+    }
+
+    Timer& timer = m_timers[index];
+    timer.callback = std::move(callback);
+    timer.deadline = m_ticks + std::max<Uint64>(delay, 1);
+    timer.interval = interval;
+    timer.pending = true;
+    schedule(index);
+    ++m_size;
+    ++m_stats.added_timers;
+    return TimerHandle {index, timer.generation};
+}
+
+void TimerWheel::schedule(std::uint32_t index) noexcept
+{
+    // The lowest level whose turn covers the delay; a timer beyond the
+    // highest turn goes to its farthest slot and is scheduled again there
+    const Uint64 deadline = m_timers[index].deadline;
+    const Uint64 delay = deadline - m_ticks;
+    std::size_t level = 0;
+    while (level + 1 < level_count && delay >= (Uint64 {1} << (slot_bits * (level + 1))))
+        ++level;
+    Uint64 position = deadline >> (slot_bits * level);
+    if (delay >> (slot_bits * level_count) != 0)
+        position = (m_ticks >> (slot_bits * level)) + slot_count - 1;
+    const auto slot = static_cast<std::uint32_t>(level * slot_count + (position & (slot_count - 1)));
+    link(index, slot);
+}
+
+void TimerWheel::link(std::uint32_t index, std::uint32_t slot) noexcept
+{
+    Timer& timer = m_timers[index];
+    timer.slot = slot;
+    timer.previous = no_timer;
+    timer.next = m_slots[slot];
+    if (timer.next != no_timer)
+        m_timers[timer.next].previous = index;
+    m_slots[slot] = index;
+    if (slot < slot_count)
+        m_occupied[slot / 64] |= std::uint64_t {1} << (slot % 64);
+}
+
+void TimerWheel::unlink(std::uint32_t index) noexcept
+{
+    Timer& timer = m_timers[index];
+    if (timer.slot == no_timer)
+        return;
+    if (timer.previous != no_timer)
+        m_timers[timer.previous].next = timer.next;
+    else
+        m_slots[timer.slot] = timer.next;
+    if (timer.next != no_timer)
+        m_timers[timer.next].previous = timer.previous;
+    if (timer.slot < slot_count && m_slots[timer.slot] == no_timer)
+        m_occupied[timer.slot / 64] &= ~(std::uint64_t {1} << (timer.slot % 64));
+    timer.slot = no_timer;
+}
+
+void TimerWheel::release(std::uint32_t index) noexcept
+{
+    Timer& timer = m_timers[index];
+    timer.callback.reset();
+    timer.pending = false;
+    ++timer.generation;
+    timer.next = m_free;
+    m_free = index;
+    --m_size;
+}
+
+void TimerWheel::cascade(std::size_t level) noexcept
+{
+    const Uint64 position = m_ticks >> (slot_bits * level);
+    const auto slot = static_cast<std::uint32_t>(level * slot_count + (position & (slot_count - 1)));
+    std::uint32_t index = std::exchange(m_slots[slot], no_timer);
+    while (index != no_timer)
+    {
+        const std::uint32_t next = m_timers[index].next;
+        schedule(index);
+        ++m_stats.cascaded_timers;
+        index = next;
+    }
+    // The turn of this level is complete as well
+    if ((position & (slot_count - 1)) == 0 && level + 1 < level_count)
+        cascade(level + 1);
+}
+
+void TimerWheel::collect(std::uint32_t slot)
+{
+    std::uint32_t index = std::exchange(m_slots[slot], no_timer);
+    m_occupied[slot / 64] &= ~(std::uint64_t {1} << (slot % 64));
+    while (index != no_timer)
+    {
+        Timer& timer = m_timers[index];
+        const std::uint32_t next = timer.next;
+        timer.slot = no_timer;
+        m_expired.push_back(TimerHandle {index, timer.generation});
+        index = next;
+    }
+}
+
+Uint64 TimerWheel::find_next_tick(Uint64 ticks) const noexcept
+{
+    // The next occupied slot of the lowest level in this turn, else the
+    // start of the next turn
+    const std::size_t index = static_cast<std::size_t>(m_ticks & (slot_count - 1));
+    const Uint64 turn = m_ticks - index;
+    Uint64 next = turn + slot_count;
+    for (std::size_t slot = index + 1; slot < slot_count;)
+    {
+        const std::uint64_t bits = m_occupied[slot / 64] >> (slot % 64);
+        if (bits != 0)
+        {
+            next = turn + slot + static_cast<std::size_t>(std::countr_zero(bits));
+            break;
+        }
+        slot = (slot / 64 + 1) * 64;
+    }
+    return std::min(next, ticks);
+}
+
+Uint32 SDLCALL TimerWheel::on_sdl_timer(void* userdata, SDL_TimerID, Uint32 interval)
+{
+    auto* const wheel = static_cast<TimerWheel*>(userdata);
+    if (!wheel->m_dispatch_pending.exchange(true, std::memory_order_acq_rel))
+    {
+        if (!SDL3PP_CALL(SDL_RunOnMainThread, &TimerWheel::on_dispatch, wheel, false))
+            wheel->m_dispatch_pending.store(false, std::memory_order_release);
+    }
+    return interval;
+}
+
+void SDLCALL TimerWheel::on_dispatch(void* userdata)
+{
+    auto* const wheel = static_cast<TimerWheel*>(userdata);
+    wheel->m_dispatch_pending.store(false, std::memory_order_release);
+    wheel->update();
+}
+
+}
@@ -0,0 +1,284 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <optional>
+#include <span>
+#include <SDL3pp/Profiler.hpp>
+#include <SDL3pp/VoiceMixer.hpp>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_AMD64)
+#include <xmmintrin.h>
+#define SDL3PP_MIXER_SSE
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define SDL3PP_MIXER_NEON
+#endif
+
+namespace SDL3pp
+{
+
+namespace
+{
+
+/**
+ * Constant-power pan law: the power of the voice does not depend on its
+ * position, and a centered voice gets a gain of sqrt(1/2) per channel.
+ */
+void channel_gains(float gain, float pan, float& left, float& right) noexcept
+{
+    const float angle = (std::clamp(pan, -1.f, 1.f) + 1.f) * std::numbers::pi_v<float> / 4.f;
+    left = gain * std::cos(angle);
+    right = gain * std::sin(angle);
+}
+
+/**
+ * Add a mono run to an interleaved stereo output, the channel gains
+ * starting at left and right and growing by left_step and right_step per
+ * frame.
+ */
+void mix_run(float* output, const float* input, std::size_t frames,
+             float left, float right, float left_step, float right_step) noexcept
+{
+    std::size_t i = 0;
+#if defined(SDL3PP_MIXER_SSE)
+    __m128 lefts = _mm_setr_ps(left, left + left_step, left + 2.f * left_step, left + 3.f * left_step);
+    __m128 rights = _mm_setr_ps(right, right + right_step, right + 2.f * right_step, right + 3.f * right_step);
+    const __m128 left_steps = _mm_set1_ps(4.f * left_step);
+    const __m128 right_steps = _mm_set1_ps(4.f * right_step);
+    for (; i + 4 <= frames; i += 4)
+    {
+        const __m128 samples = _mm_loadu_ps(input + i);
+        const __m128 l = _mm_mul_ps(samples, lefts);
+        const __m128 r = _mm_mul_ps(samples, rights);
+        float* out = output + 2 * i;
+        _mm_storeu_ps(out, _mm_add_ps(_mm_loadu_ps(out), _mm_unpacklo_ps(l, r)));
+        _mm_storeu_ps(out + 4, _mm_add_ps(_mm_loadu_ps(out + 4), _mm_unpackhi_ps(l, r)));
+        lefts = _mm_add_ps(lefts, left_steps);
+        rights = _mm_add_ps(rights, right_steps);
+    }
+#elif defined(SDL3PP_MIXER_NEON)
+    float32x4_t lefts = {left, left + left_step, left + 2.f * left_step, left + 3.f * left_step};
+    float32x4_t rights = {right, right + right_step, right + 2.f * right_step, right + 3.f * right_step};
+    const float32x4_t left_steps = vdupq_n_f32(4.f * left_step);
+    const float32x4_t right_steps = vdupq_n_f32(4.f * right_step);
+    for (; i + 4 <= frames; i += 4)
+    {
+        const float32x4_t samples = vld1q_f32(input + i);
+        const float32x4x2_t mixed = vzipq_f32(vmulq_f32(samples, lefts), vmulq_f32(samples, rights));
+        float* out = output + 2 * i;
+        vst1q_f32(out, vaddq_f32(vld1q_f32(out), mixed.val[0]));
+        vst1q_f32(out + 4, vaddq_f32(vld1q_f32(out + 4), mixed.val[1]));
+        lefts = vaddq_f32(lefts, left_steps);
+        rights = vaddq_f32(rights, right_steps);
+    }
+#endif
+    for (; i < frames; ++i)
+    {
+        const auto step = static_cast<float>(i);
+        output[2 * i] += input[i] * (left + left_step * step);
+        output[2 * i + 1] += input[i] * (right + right_step * step);
+    }
+}
+
+}
+
+VoiceMixer::VoiceMixer(std::size_t capacity, std::size_t block_frames)
+ : m_voices(capacity),
+   m_free(),
+   m_active(),
+   m_block(block_frames * 2)
+{
+    m_free.reserve(capacity);
+    for (std::size_t index = capacity; index-- > 0;)
+        m_free.push_back(static_cast<std::uint32_t>(index));
+    m_active.reserve(capacity);
+}
+
+std::optional<VoiceHandle> VoiceMixer::play(std::span<const float> samples, float gain, float pan, bool loop) noexcept
+{
+    if (m_free.empty())
+    {
+        ++m_stats.rejected_voices;
+        return std::nullopt;
+    }
+    const std::uint32_t index = m_free.back();
+    m_free.pop_back();
+
+    Voice& voice = m_voices[index];
+    voice.samples = samples.data();
+    voice.length = samples.size();
+    voice.position = 0;
+    voice.loop = loop;
+    voice.playing = true;
+    voice.stopping = false;
+    voice.gain = gain;
+    voice.pan = pan;
+    channel_gains(gain, pan, voice.left, voice.right);
+    voice.ramp_frames = 0;
+    voice.active_slot = static_cast<std::uint32_t>(m_active.size());
+    m_active.push_back(index);
+
+    ++m_stats.started_voices;
+    return VoiceHandle{index, voice.generation};
+}
+
+void VoiceMixer::stop(VoiceHandle voice, std::uint32_t fade_frames) noexcept
+{
+    Voice* const found = find(voice);
+    if (found == nullptr)
+        return;
+    if (fade_frames == 0)
+    {
+        release(voice.index);
+        return;
+    }
+    found->gain = 0.f;
+    found->stopping = true;
+    ramp_to(*found, fade_frames);
+}
+
+void VoiceMixer::stop_all() noexcept
+{
+    while (!m_active.empty())
+        release(m_active.back());
+}
+
+void VoiceMixer::set_gain(VoiceHandle voice, float gain, std::uint32_t ramp_frames) noexcept
+{
+    Voice* const found = find(voice);
+    if (found == nullptr || found->stopping)
+        return;
+    found->gain = gain;
+    ramp_to(*found, ramp_frames);
+}
+
+void VoiceMixer::set_pan(VoiceHandle voice, float pan, std::uint32_t ramp_frames) noexcept
+{
+    Voice* const found = find(voice);
+    if (found == nullptr || found->stopping)
+        return;
+    found->pan = pan;
+    ramp_to(*found, ramp_frames);
+}
+
+bool VoiceMixer::is_playing(VoiceHandle voice) const noexcept
+{
+    return voice.index < m_voices.size() && m_voices[voice.index].generation == voice.generation
+        && m_voices[voice.index].playing;
+}
+
+void VoiceMixer::mix(std::span<float> output) noexcept
+{
+    SDL3PP_ZONE("VoiceMixer::mix");
+    std::fill(output.begin(), output.end(), 0.f);
+    const std::size_t frames = output.size() / 2;
+    for (std::size_t slot = 0; slot < m_active.size();)
+    {
+        const std::uint32_t index = m_active[slot];
+        if (mix_voice(m_voices[index], output.data(), frames))
+            ++slot;
+        else
+            release(index);
+    }
+}
+
+std::size_t VoiceMixer::mix(AudioStream& stream) noexcept
+{
+    const std::size_t block_frames = m_block.size() / 2;
+    std::size_t written = 0;
+    for (;;)
+    {
+        const std::size_t frames = std::min(block_frames, stream.get_writable_frames());
+        if (frames == 0)
+            break;
+        const std::span<float> block(m_block.data(), frames * 2);
+        mix(block);
+        written += stream.write(block);
+        if (frames < block_frames)
+            break;
+    }
+    return written;
+}
+
+VoiceMixer::Voice* VoiceMixer::find(VoiceHandle voice) noexcept
+{
+    if (!is_playing(voice))
+        return nullptr;
+    return &m_voices[voice.index];
+}
+
+void VoiceMixer::ramp_to(Voice& voice, std::uint32_t frames) noexcept
+{
+    float left = 0.f;
+    float right = 0.f;
+    channel_gains(voice.gain, voice.pan, left, right);
+    voice.ramp_frames = frames;
+    if (frames == 0)
+    {
+        voice.left = left;
+        voice.right = right;
+        return;
+    }
+    voice.left_step = (left - voice.left) / static_cast<float>(frames);
+    voice.right_step = (right - voice.right) / static_cast<float>(frames);
+}
+
+bool VoiceMixer::mix_voice(Voice& voice, float* output, std::size_t frames) noexcept
+{
+    std::size_t done = 0;
+    while (done < frames)
+    {
+        if (voice.position == voice.length)
+        {
+            if (!voice.loop || voice.length == 0)
+                return false;
+            voice.position = 0;
+        }
+
+        std::size_t run = std::min(frames - done, voice.length - voice.position);
+        const bool ramping = voice.ramp_frames > 0;
+        if (ramping)
+            run = std::min<std::size_t>(run, voice.ramp_frames);
+        mix_run(output + 2 * done, voice.samples + voice.position, run, voice.left, voice.right,
+                ramping ? voice.left_step : 0.f, ramping ? voice.right_step : 0.f);
+        m_stats.mixed_voice_frames += run;
+        done += run;
+        voice.position += run;
+
+        if (ramping)
+        {
+            voice.ramp_frames -= static_cast<std::uint32_t>(run);
+            if (voice.ramp_frames == 0)
+            {
+                // Land exactly on the target, whatever the rounding
+                if (voice.stopping)
+                    return false;
+                channel_gains(voice.gain, voice.pan, voice.left, voice.right);
+            }
+            else
+            {
+                voice.left += voice.left_step * static_cast<float>(run);
+                voice.right += voice.right_step * static_cast<float>(run);
+            }
+        }
+    }
+    return voice.loop ? voice.length > 0 : voice.position < voice.length;
+}
+
+void VoiceMixer::release(std::uint32_t index) noexcept
+{
+    Voice& voice = m_voices[index];
+    voice.playing = false;
+    ++voice.generation;
+
+    // Swap with the last active voice to keep the active list dense
+    const std::uint32_t last = m_active.back();
+    m_active[voice.active_slot] = last;
+    m_voices[last].active_slot = voice.active_slot;
+    m_active.pop_back();
+    m_free.push_back(index);
+}
+
+}
@@ -1,7 +1,9 @@
 #include <string>
 #include <source_location>
 #include <SDL3/SDL_video.h>
+#include <SDL3pp/CallTracker.hpp>
 #include <SDL3pp/Exception.hpp>
+#include <SDL3pp/MemoryTracker.hpp>
 #include <SDL3pp/Window.hpp>
 
 namespace SDL3pp
@@ -11,7 +13,8 @@ Window::Window(std::string const& title, int w, int h, WindowFlags flags)
  : m_window(),  
    m_parent_window(nullptr)
 {
-    m_window = SDL_CreateWindow(title.data(), w, h, flags);
+    const MemoryScope scope(MemoryTag::video);
+    m_window.reset(SDL3PP_CALL(SDL_CreateWindow, title.data(), w, h, flags));
     if (m_window == nullptr)
     {
         const std::source_location& loc {std::source_location::current()};
@@ -23,7 +26,8 @@ Window::Window(Window& parent, int offset_x, int offset_y, int w, int h, WindowF
 : m_window(),  
   m_parent_window(&parent)
 {
-    m_window = SDL_CreatePopupWindow(parent.m_window.get(), offset_x, offset_y, w, h, flags);
+    const MemoryScope scope(MemoryTag::video);
+    m_window.reset(SDL3PP_CALL(SDL_CreatePopupWindow, parent.m_window.get(), offset_x, offset_y, w, h, flags));
     if (m_window == nullptr)
     {
         const std::source_location& loc {std::source_location::current()};
@@ -35,18 +39,10 @@ Window& Window::operator=(Window&& other)
 {
     if (&other == this)
         return *this;
-    if (m_window != nullptr)
-        SDL_DestroyWindow(m_window);
     m_window = std::move(other.m_window);
     m_parent_window = std::move(other.m_parent_window);
     other.m_parent_window = nullptr;
     return *this;
 }
 
-Window::~Window()
-{
-    if (m_window != nullptr)
-        SDL_DestroyWindow(m_window);
-}
-
 }
\ No newline at end of file